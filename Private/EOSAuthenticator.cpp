@@ -31,6 +31,15 @@ void UEOSAuthenticator::Authenticate(const FString& UserID, const FString& UserT
         return;
     }
 
+    // Throttle repeated login attempts
+    FString RateLimitError;
+    if (!EOSStrategyCorePtr->GetRateLimiter()->TryAcquire(EBackendOperation::Authenticate, ERequestPriority::Interactive, RateLimitError)) {
+        if (OnAuthenticationCompleted.IsBound()) {
+            OnAuthenticationCompleted.Broadcast(false, RateLimitError);
+        }
+        return;
+    }
+
     // Create account credentials
     FOnlineAccountCredentials AccountCredentials;
     AccountCredentials.Id = UserID;
@@ -50,6 +59,13 @@ void UEOSAuthenticator::OnAuthenticateCompleted(int32 LocalUserNum, bool bWasSuc
     // Remove delegate
     EOSStrategyCorePtr->GetOnlineIdentity()->ClearOnLoginCompleteDelegates(0, this);
 
+    // Feed the result to the rate limiter backoff
+    if (bWasSuccess) {
+        EOSStrategyCorePtr->GetRateLimiter()->ReportSuccess(EBackendOperation::Authenticate);
+    } else {
+        EOSStrategyCorePtr->GetRateLimiter()->ReportFailure(EBackendOperation::Authenticate);
+    }
+
     // Broadcast authentication completion event
     if (OnAuthenticationCompleted.IsBound()) {
         OnAuthenticationCompleted.Broadcast(bWasSuccess, *Error);
@@ -0,0 +1,277 @@
+/**
+ * @file EOSFriends.cpp
+ *
+ * @brief Author: Marcel Gheorghe Becheanu
+ * @brief Last Updated: October 18, 2026
+ * @brief Github: https://github.com/marcelbecheanu
+ *
+ * This file contains the implementation of the UEOSFriends class, which keeps the friends list and presence in sync and joins friends' sessions.
+ */
+
+#include "EOSFriends.h"
+#include "EOSStrategyCore.h"
+#include "Interfaces/OnlineFriendsInterface.h"
+#include "Interfaces/OnlinePresenceInterface.h"
+#include "Interfaces/OnlineSessionInterface.h"
+
+// Initialize method to set the EOS strategy core
+void UEOSFriends::Initialize(UEOSStrategyCore* EOSStrategyCore)
+{
+    EOSStrategyCorePtr = EOSStrategyCore;
+    checkf(EOSStrategyCorePtr != nullptr, TEXT("Failed to initialize EOSStrategyCore in EOSFriends!"));
+}
+
+FFriendInfo UEOSFriends::MakeFriendInfo(const FOnlineFriend& Friend)
+{
+    FFriendInfo FriendInfo;
+    FriendInfo.UserID = Friend.GetUserId()->ToString();
+    FriendInfo.DisplayName = Friend.GetDisplayName();
+    ApplyPresence(FriendInfo, Friend.GetPresence());
+    return FriendInfo;
+}
+
+void UEOSFriends::ApplyPresence(FFriendInfo& FriendInfo, const FOnlineUserPresence& Presence)
+{
+    FriendInfo.Status = Presence.Status.StatusStr;
+    FriendInfo.bIsOnline = Presence.bIsOnline;
+    FriendInfo.bIsPlayingThisGame = Presence.bIsPlayingThisGame;
+    FriendInfo.bIsJoinable = Presence.bIsJoinable;
+    FriendInfo.SessionID = Presence.SessionId.IsValid() ? Presence.SessionId->ToString() : FString();
+}
+
+// Reads the friends list, the result is diffed against the cache in OnReadFriendsListCompleted
+void UEOSFriends::RefreshFriendsList()
+{
+    if (!EOSStrategyCorePtr->HasOnlineFriends() || !EOSStrategyCorePtr->GetAuthenticator()->IsAuthenticated())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Cannot read friends list. Online friends not available or not authenticated."));
+        return;
+    }
+
+    TWeakObjectPtr<UEOSFriends> WeakThis(this);
+    if (EOSStrategyCorePtr->GetRequestJournal()->DeferIfOffline(EBackendOperation::ReadFriends, TEXT("ReadFriends"), [WeakThis]()
+    {
+        if (UEOSFriends* FriendsHandler = WeakThis.Get())
+        {
+            FriendsHandler->RefreshFriendsList();
+        }
+    }))
+    {
+        return;
+    }
+
+    // Event driven refreshes are background requests, the first read is made for the player
+    FString RateLimitError;
+    const ERequestPriority Priority = bIsFriendsListSynced ? ERequestPriority::Background : ERequestPriority::Interactive;
+    if (!EOSStrategyCorePtr->GetRateLimiter()->TryAcquire(EBackendOperation::ReadFriends, Priority, RateLimitError))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Cannot read friends list. %s"), *RateLimitError);
+        return;
+    }
+
+    EOSStrategyCorePtr->GetOnlineFriends()->ReadFriendsList(0, EFriendsLists::ToString(EFriendsLists::Default),
+        FOnReadFriendsListComplete::CreateUObject(this, &UEOSFriends::OnReadFriendsListCompleted));
+}
+
+void UEOSFriends::OnReadFriendsListCompleted(int32 LocalUserNum, bool bWasSuccessful, const FString& ListName, const FString& Error)
+{
+    if (!bWasSuccessful)
+    {
+        EOSStrategyCorePtr->GetRateLimiter()->ReportFailure(EBackendOperation::ReadFriends);
+        UE_LOG(LogTemp, Error, TEXT("Failed to read friends list. Reason: %s"), *Error);
+        return;
+    }
+    EOSStrategyCorePtr->GetRateLimiter()->ReportSuccess(EBackendOperation::ReadFriends);
+
+    TArray<TSharedRef<FOnlineFriend>> OnlineFriends;
+    EOSStrategyCorePtr->GetOnlineFriends()->GetFriendsList(LocalUserNum, ListName, OnlineFriends);
+
+    // Only report the friends that changed, so widgets update single rows
+    TArray<FFriendInfo> Changed;
+    TArray<FString> Removed;
+    TMap<FString, FFriendInfo> CurrentFriends;
+    TMap<FString, FUniqueNetIdRef> CurrentFriendNetIds;
+    CurrentFriends.Reserve(OnlineFriends.Num());
+    CurrentFriendNetIds.Reserve(OnlineFriends.Num());
+
+    for (const TSharedRef<FOnlineFriend>& OnlineFriend : OnlineFriends)
+    {
+        FFriendInfo FriendInfo = MakeFriendInfo(*OnlineFriend);
+        const FFriendInfo* Previous = Friends.Find(FriendInfo.UserID);
+        if (Previous == nullptr || Previous->ComputeFingerprint() != FriendInfo.ComputeFingerprint())
+        {
+            Changed.Add(FriendInfo);
+        }
+        CurrentFriendNetIds.Add(FriendInfo.UserID, OnlineFriend->GetUserId());
+        CurrentFriends.Add(FriendInfo.UserID, MoveTemp(FriendInfo));
+    }
+    for (const TPair<FString, FFriendInfo>& Known : Friends)
+    {
+        if (!CurrentFriends.Contains(Known.Key))
+        {
+            Removed.Add(Known.Key);
+        }
+    }
+    Friends = MoveTemp(CurrentFriends);
+    FriendNetIds = MoveTemp(CurrentFriendNetIds);
+
+    // From now on the cache is kept in sync by events instead of polling
+    if (!bIsFriendsListSynced)
+    {
+        bIsFriendsListSynced = true;
+        FriendsChangeDelegateHandle = EOSStrategyCorePtr->GetOnlineFriends()->AddOnFriendsChangeDelegate_Handle(0,
+            FOnFriendsChangeDelegate::CreateUObject(this, &UEOSFriends::OnFriendsChanged));
+        if (EOSStrategyCorePtr->HasOnlinePresence())
+        {
+            PresenceReceivedDelegateHandle = EOSStrategyCorePtr->GetOnlinePresence()->AddOnPresenceReceivedDelegate_Handle(
+                FOnPresenceReceivedDelegate::CreateUObject(this, &UEOSFriends::OnPresenceReceived));
+        }
+    }
+
+    if ((Changed.Num() > 0 || Removed.Num() > 0) && OnFriendsListUpdatedDelegate.IsBound())
+    {
+        OnFriendsListUpdatedDelegate.Broadcast(Changed, Removed);
+    }
+}
+
+void UEOSFriends::OnFriendsChanged()
+{
+    RefreshFriendsList();
+}
+
+// Presence updates touch a single cached friend without reading the whole list
+void UEOSFriends::OnPresenceReceived(const FUniqueNetId& UserId, const TSharedRef<FOnlineUserPresence>& Presence)
+{
+    FFriendInfo* FriendInfo = Friends.Find(UserId.ToString());
+    if (FriendInfo == nullptr)
+    {
+        return;
+    }
+
+    const uint32 PreviousFingerprint = FriendInfo->ComputeFingerprint();
+    ApplyPresence(*FriendInfo, *Presence);
+    if (FriendInfo->ComputeFingerprint() != PreviousFingerprint && OnFriendsListUpdatedDelegate.IsBound())
+    {
+        OnFriendsListUpdatedDelegate.Broadcast(TArray<FFriendInfo>{ *FriendInfo }, TArray<FString>());
+    }
+}
+
+TArray<FFriendInfo> UEOSFriends::GetFriends() const
+{
+    TArray<FFriendInfo> Result;
+    Friends.GenerateValueArray(Result);
+    return Result;
+}
+
+bool UEOSFriends::GetFriend(const FString& UserID, FFriendInfo& OutFriend) const
+{
+    const FFriendInfo* FriendInfo = Friends.Find(UserID);
+    if (FriendInfo == nullptr)
+    {
+        return false;
+    }
+
+    OutFriend = *FriendInfo;
+    return true;
+}
+
+void UEOSFriends::FindFriendSession(const FString& UserID)
+{
+    bJoinFoundFriendSession = false;
+
+    if (!EOSStrategyCorePtr->HasOnlineSession())
+    {
+        HandleFindFriendSessionFailure("Online Session is not available.");
+        return;
+    }
+    if (!EOSStrategyCorePtr->GetAuthenticator()->IsAuthenticated())
+    {
+        HandleFindFriendSessionFailure("Player authentication failed. Please log in to your account.");
+        return;
+    }
+    if (FindFriendSessionDelegateHandle.IsValid())
+    {
+        HandleFindFriendSessionFailure("A friend session search is already in progress.");
+        return;
+    }
+
+    const FUniqueNetIdRef* FriendNetId = FriendNetIds.Find(UserID);
+    if (FriendNetId == nullptr)
+    {
+        HandleFindFriendSessionFailure("User is not in the friends list. Refresh the friends list and try again.");
+        return;
+    }
+
+    // Presence already tells whether there is anything to find
+    const FFriendInfo& FriendInfo = Friends.FindChecked(UserID);
+    if (EOSStrategyCorePtr->HasOnlinePresence() && (!FriendInfo.bIsPlayingThisGame || FriendInfo.SessionID.IsEmpty()))
+    {
+        HandleFindFriendSessionFailure("Friend is not in a session.");
+        return;
+    }
+
+    FString RateLimitError;
+    if (!EOSStrategyCorePtr->GetRateLimiter()->TryAcquire(EBackendOperation::FindFriendSession, ERequestPriority::Interactive, RateLimitError))
+    {
+        HandleFindFriendSessionFailure(RateLimitError);
+        return;
+    }
+
+    FindFriendSessionDelegateHandle = EOSStrategyCorePtr->GetOnlineSession()->AddOnFindFriendSessionCompleteDelegate_Handle(0,
+        FOnFindFriendSessionCompleteDelegate::CreateUObject(this, &UEOSFriends::OnFindFriendSessionCompleted));
+    if (!EOSStrategyCorePtr->GetOnlineSession()->FindFriendSession(0, **FriendNetId))
+    {
+        EOSStrategyCorePtr->GetOnlineSession()->ClearOnFindFriendSessionCompleteDelegate_Handle(0, FindFriendSessionDelegateHandle);
+        HandleFindFriendSessionFailure("Failed to start friend session search.");
+    }
+}
+
+void UEOSFriends::JoinFriend(const FString& UserID)
+{
+    FindFriendSession(UserID);
+
+    // Only join if the search was started, failures have already been broadcast
+    bJoinFoundFriendSession = FindFriendSessionDelegateHandle.IsValid();
+}
+
+void UEOSFriends::OnFindFriendSessionCompleted(int32 LocalUserNum, bool bWasSuccessful, const TArray<FOnlineSessionSearchResult>& SearchResults)
+{
+    EOSStrategyCorePtr->GetOnlineSession()->ClearOnFindFriendSessionCompleteDelegate_Handle(0, FindFriendSessionDelegateHandle);
+
+    if (!bWasSuccessful)
+    {
+        EOSStrategyCorePtr->GetRateLimiter()->ReportFailure(EBackendOperation::FindFriendSession);
+        HandleFindFriendSessionFailure("Failed to find friend session.");
+        return;
+    }
+    EOSStrategyCorePtr->GetRateLimiter()->ReportSuccess(EBackendOperation::FindFriendSession);
+
+    if (SearchResults.Num() == 0 || !SearchResults[0].IsValid())
+    {
+        HandleFindFriendSessionFailure("Friend is not in a session.");
+        return;
+    }
+
+    const FSessionServer SessionServer(SearchResults[0]);
+    if (OnFindFriendSessionCompletedDelegate.IsBound())
+    {
+        OnFindFriendSessionCompletedDelegate.Broadcast(SessionServer, true, "Success!");
+    }
+
+    if (bJoinFoundFriendSession)
+    {
+        bJoinFoundFriendSession = false;
+        EOSStrategyCorePtr->GetSession()->JoinOnlineSession(SessionServer);
+    }
+}
+
+void UEOSFriends::HandleFindFriendSessionFailure(const FString& ErrorMessage)
+{
+    bJoinFoundFriendSession = false;
+
+    UE_LOG(LogTemp, Error, TEXT("%s"), *ErrorMessage);
+    if (OnFindFriendSessionCompletedDelegate.IsBound())
+    {
+        OnFindFriendSessionCompletedDelegate.Broadcast(FSessionServer(), false, ErrorMessage);
+    }
+}
@@ -0,0 +1,333 @@
+/**
+ * @file EOSLeaderboards.cpp
+ *
+ * @brief Author: Marcel Gheorghe Becheanu
+ * @brief Last Updated: October 18, 2026
+ * @brief Github: https://github.com/marcelbecheanu
+ *
+ * This file contains the implementation of the UEOSLeaderboards class, which queries and caches leaderboard pages from EOS.
+ */
+
+#include "EOSLeaderboards.h"
+#include "EOSStrategyCore.h"
+#include "Interfaces/OnlineIdentityInterface.h"
+#include "Interfaces/OnlineLeaderboardInterface.h"
+#include "OnlineStats.h"
+
+// Initialize method to set the EOS strategy core
+void UEOSLeaderboards::Initialize(UEOSStrategyCore* EOSStrategyCore)
+{
+    EOSStrategyCorePtr = EOSStrategyCore;
+    checkf(EOSStrategyCorePtr != nullptr, TEXT("Failed to initialize EOSStrategyCore in EOSLeaderboards!"));
+}
+
+FString UEOSLeaderboards::MakeRequestKey(const FLeaderboardPage& Page) const
+{
+    FString Key = FString::Printf(TEXT("%s|%s|%d|%d"), *Page.LeaderboardName, *Page.StatName, static_cast<int32>(Page.QueryType), Page.PageIndex);
+
+    // Around me and friends pages depend on who is logged in, another user must not be served them
+    if (Page.QueryType != ELeaderboardQueryType::Range)
+    {
+        const FUniqueNetIdPtr LocalUserId = EOSStrategyCorePtr->HasOnlineIdentity() ? EOSStrategyCorePtr->GetOnlineIdentity()->GetUniquePlayerId(0) : nullptr;
+        Key += TEXT("|") + (LocalUserId.IsValid() ? LocalUserId->ToString() : FString());
+    }
+    return Key;
+}
+
+void UEOSLeaderboards::EvictExpiredPages()
+{
+    const double Now = FPlatformTime::Seconds();
+    for (auto It = CachedPages.CreateIterator(); It; ++It)
+    {
+        if (Now - It.Value().FetchedAt >= CacheTTLSeconds)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void UEOSLeaderboards::QueryLeaderboardPage(const FString& LeaderboardName, const FString& StatName, int32 PageIndex)
+{
+    FLeaderboardPage Page;
+    Page.LeaderboardName = LeaderboardName;
+    Page.StatName = StatName;
+    Page.QueryType = ELeaderboardQueryType::Range;
+    Page.PageIndex = FMath::Max(0, PageIndex);
+    Query(Page, true);
+}
+
+void UEOSLeaderboards::QueryLeaderboardAroundMe(const FString& LeaderboardName, const FString& StatName)
+{
+    FLeaderboardPage Page;
+    Page.LeaderboardName = LeaderboardName;
+    Page.StatName = StatName;
+    Page.QueryType = ELeaderboardQueryType::AroundMe;
+    Query(Page, true);
+}
+
+void UEOSLeaderboards::QueryLeaderboardFriends(const FString& LeaderboardName, const FString& StatName)
+{
+    FLeaderboardPage Page;
+    Page.LeaderboardName = LeaderboardName;
+    Page.StatName = StatName;
+    Page.QueryType = ELeaderboardQueryType::Friends;
+    Query(Page, true);
+}
+
+void UEOSLeaderboards::InvalidateLeaderboardCache(const FString& LeaderboardName)
+{
+    const FString Prefix = LeaderboardName + TEXT("|");
+    for (auto It = CachedPages.CreateIterator(); It; ++It)
+    {
+        if (It.Key().StartsWith(Prefix))
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    // Requested pages are read after this call and stay queued, prefetches are only worth it for pages being browsed
+    PendingRequests.RemoveAll([&Prefix](const FLeaderboardRequest& Request) { return !Request.bBroadcast && Request.Key.StartsWith(Prefix); });
+
+    // The read in flight may predate the change, it is still delivered but not cached
+    if (ActiveRequest.IsSet() && ActiveRequest->Key.StartsWith(Prefix))
+    {
+        ActiveRequest->bIsInvalidated = true;
+    }
+}
+
+// Serves fresh pages from the cache, otherwise queues the read unless the same page is already queued
+void UEOSLeaderboards::Query(const FLeaderboardPage& Page, bool bBroadcast)
+{
+    const FString Key = MakeRequestKey(Page);
+
+    EvictExpiredPages();
+    const FCachedLeaderboardPage* Cached = CachedPages.Find(Key);
+    if (Cached != nullptr)
+    {
+        if (bBroadcast)
+        {
+            FLeaderboardPage CachedPage = Page;
+            CachedPage.Entries = Cached->Entries;
+            CachedPage.bFromCache = true;
+            if (OnLeaderboardQueryCompletedDelegate.IsBound())
+            {
+                OnLeaderboardQueryCompletedDelegate.Broadcast(CachedPage, true, "Success!");
+            }
+            Prefetch(Page);
+        }
+        return;
+    }
+
+    // Coalesce with the read in flight or queued, a prefetch becomes a requested page if needed
+    if (ActiveRequest.IsSet() && ActiveRequest->Key == Key && !ActiveRequest->bIsInvalidated)
+    {
+        ActiveRequest->bBroadcast |= bBroadcast;
+        return;
+    }
+    if (FLeaderboardRequest* Queued = PendingRequests.FindByPredicate([&Key](const FLeaderboardRequest& Request) { return Request.Key == Key; }))
+    {
+        if (bBroadcast && !Queued->bBroadcast)
+        {
+            FLeaderboardRequest Promoted = MoveTemp(*Queued);
+            Promoted.bBroadcast = true;
+            PendingRequests.RemoveAll([&Key](const FLeaderboardRequest& Request) { return Request.Key == Key; });
+            PendingRequests.Insert(MoveTemp(Promoted), 0);
+        }
+        return;
+    }
+
+    FLeaderboardRequest Request;
+    Request.Key = Key;
+    Request.Page = Page;
+    Request.bBroadcast = bBroadcast;
+
+    // Requested pages go ahead of prefetches
+    if (bBroadcast)
+    {
+        const int32 FirstPrefetch = PendingRequests.IndexOfByPredicate([](const FLeaderboardRequest& Queued) { return !Queued.bBroadcast; });
+        PendingRequests.Insert(MoveTemp(Request), FirstPrefetch == INDEX_NONE ? PendingRequests.Num() : FirstPrefetch);
+    }
+    else
+    {
+        PendingRequests.Add(MoveTemp(Request));
+    }
+
+    ProcessNextRequest();
+}
+
+// Scrolling usually moves one page at a time, so keep the neighbours warm
+void UEOSLeaderboards::Prefetch(const FLeaderboardPage& Page)
+{
+    if (!bPrefetchAdjacentPages || Page.QueryType != ELeaderboardQueryType::Range)
+    {
+        return;
+    }
+
+    FLeaderboardPage Adjacent = Page;
+    Adjacent.Entries.Empty();
+    Adjacent.bFromCache = false;
+
+    Adjacent.PageIndex = Page.PageIndex + 1;
+    Query(Adjacent, false);
+    if (Page.PageIndex > 0)
+    {
+        Adjacent.PageIndex = Page.PageIndex - 1;
+        Query(Adjacent, false);
+    }
+}
+
+void UEOSLeaderboards::ProcessNextRequest()
+{
+    while (!ActiveRequest.IsSet() && PendingRequests.Num() > 0)
+    {
+        FLeaderboardRequest Request = PendingRequests[0];
+        PendingRequests.RemoveAt(0);
+
+        FString Error;
+        if (StartRead(Request, Error))
+        {
+            return;
+        }
+
+        if (Request.bBroadcast)
+        {
+            HandleLeaderboardQueryFailure(Request.Page, Error);
+        }
+    }
+}
+
+bool UEOSLeaderboards::StartRead(const FLeaderboardRequest& Request, FString& OutError)
+{
+    if (!EOSStrategyCorePtr->HasOnlineLeaderboards())
+    {
+        OutError = "Online Leaderboards is not available.";
+        return false;
+    }
+    if (!EOSStrategyCorePtr->GetAuthenticator()->IsAuthenticated())
+    {
+        OutError = "Player authentication failed. Please log in to your account.";
+        return false;
+    }
+    if (!EOSStrategyCorePtr->GetRateLimiter()->TryAcquire(EBackendOperation::ReadLeaderboard, Request.bBroadcast ? ERequestPriority::Interactive : ERequestPriority::Background, OutError))
+    {
+        return false;
+    }
+
+    FOnlineLeaderboardReadRef ReadObject = MakeShared<FOnlineLeaderboardRead, ESPMode::ThreadSafe>();
+    ReadObject->LeaderboardName = FName(*Request.Page.LeaderboardName);
+    ReadObject->SortedColumn = FName(*Request.Page.StatName);
+    ReadObject->ColumnMetadata.Add(FColumnMetaData(ReadObject->SortedColumn, EOnlineKeyValuePairDataType::Int32));
+
+    ActiveRequest = Request;
+    ActiveReadObject = ReadObject;
+
+    const IOnlineLeaderboardsPtr OnlineLeaderboards = EOSStrategyCorePtr->GetOnlineLeaderboards();
+    ReadCompleteDelegateHandle = OnlineLeaderboards->AddOnLeaderboardReadCompleteDelegate_Handle(
+        FOnLeaderboardReadCompleteDelegate::CreateUObject(this, &UEOSLeaderboards::OnLeaderboardReadCompleted));
+
+    bool bStarted = false;
+    switch (Request.Page.QueryType)
+    {
+    case ELeaderboardQueryType::AroundMe:
+        if (const FUniqueNetIdPtr LocalUserId = EOSStrategyCorePtr->GetOnlineIdentity()->GetUniquePlayerId(0))
+        {
+            bStarted = OnlineLeaderboards->ReadLeaderboardsAroundUser(LocalUserId.ToSharedRef(), PageSize / 2, ReadObject);
+        }
+        break;
+    case ELeaderboardQueryType::Friends:
+        bStarted = OnlineLeaderboards->ReadLeaderboardsForFriends(0, ReadObject);
+        break;
+    default:
+        {
+            // Ranks are 1-based, read the window centred on the page and trim it on completion
+            const int32 HalfRange = (PageSize + 1) / 2;
+            const int32 FirstRank = Request.Page.PageIndex * PageSize + 1;
+            bStarted = OnlineLeaderboards->ReadLeaderboardsAroundRank(FirstRank + HalfRange, HalfRange, ReadObject);
+        }
+        break;
+    }
+
+    if (!bStarted && ActiveRequest.IsSet() && ActiveRequest->Key == Request.Key)
+    {
+        OnlineLeaderboards->ClearOnLeaderboardReadCompleteDelegate_Handle(ReadCompleteDelegateHandle);
+        ActiveRequest.Reset();
+        ActiveReadObject.Reset();
+        OutError = "Failed to read leaderboard.";
+        return false;
+    }
+    return true;
+}
+
+void UEOSLeaderboards::OnLeaderboardReadCompleted(bool bWasSuccessful)
+{
+    EOSStrategyCorePtr->GetOnlineLeaderboards()->ClearOnLeaderboardReadCompleteDelegate_Handle(ReadCompleteDelegateHandle);
+    if (!ActiveRequest.IsSet())
+    {
+        return;
+    }
+
+    FLeaderboardRequest Request = ActiveRequest.GetValue();
+    TSharedPtr<FOnlineLeaderboardRead, ESPMode::ThreadSafe> ReadObject = ActiveReadObject;
+    ActiveRequest.Reset();
+    ActiveReadObject.Reset();
+
+    if (!bWasSuccessful)
+    {
+        EOSStrategyCorePtr->GetRateLimiter()->ReportFailure(EBackendOperation::ReadLeaderboard);
+        if (Request.bBroadcast)
+        {
+            HandleLeaderboardQueryFailure(Request.Page, "Failed to read leaderboard.");
+        }
+        ProcessNextRequest();
+        return;
+    }
+    EOSStrategyCorePtr->GetRateLimiter()->ReportSuccess(EBackendOperation::ReadLeaderboard);
+
+    const int32 FirstRank = Request.Page.PageIndex * PageSize + 1;
+    FCachedLeaderboardPage Cached;
+    Cached.FetchedAt = FPlatformTime::Seconds();
+    Cached.Entries.Reserve(ReadObject->Rows.Num());
+    for (const FOnlineStatsRow& Row : ReadObject->Rows)
+    {
+        if (Request.Page.QueryType == ELeaderboardQueryType::Range && (Row.Rank < FirstRank || Row.Rank >= FirstRank + PageSize))
+        {
+            continue;
+        }
+
+        FLeaderboardEntry& Entry = Cached.Entries.AddDefaulted_GetRef();
+        Entry.Rank = Row.Rank;
+        Entry.UserID = Row.PlayerId.IsValid() ? Row.PlayerId->ToString() : FString();
+        Entry.Nickname = Row.NickName;
+        if (const FVariantData* Score = Row.Columns.Find(ReadObject->SortedColumn))
+        {
+            Score->GetValue(Entry.Score);
+        }
+    }
+    Cached.Entries.Sort([](const FLeaderboardEntry& A, const FLeaderboardEntry& B) { return A.Rank < B.Rank; });
+    if (!Request.bIsInvalidated)
+    {
+        CachedPages.Add(Request.Key, Cached);
+    }
+
+    if (Request.bBroadcast)
+    {
+        FLeaderboardPage Page = Request.Page;
+        Page.Entries = Cached.Entries;
+        if (OnLeaderboardQueryCompletedDelegate.IsBound())
+        {
+            OnLeaderboardQueryCompletedDelegate.Broadcast(Page, true, "Success!");
+        }
+        Prefetch(Request.Page);
+    }
+
+    ProcessNextRequest();
+}
+
+void UEOSLeaderboards::HandleLeaderboardQueryFailure(const FLeaderboardPage& Page, const FString& ErrorMessage) const
+{
+    UE_LOG(LogTemp, Error, TEXT("%s"), *ErrorMessage);
+    if (OnLeaderboardQueryCompletedDelegate.IsBound())
+    {
+        OnLeaderboardQueryCompletedDelegate.Broadcast(Page, false, ErrorMessage);
+    }
+}
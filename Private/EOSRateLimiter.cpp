@@ -0,0 +1,130 @@
+/**
+ * @file EOSRateLimiter.cpp
+ *
+ * @brief Author: Marcel Gheorghe Becheanu
+ * @brief Last Updated: October 18, 2026
+ * @brief Github: https://github.com/marcelbecheanu
+ *
+ * This file contains the implementation of the UEOSRateLimiter class, which throttles backend calls made through EOS.
+ */
+
+#include "EOSRateLimiter.h"
+#include "EOSStrategyCore.h"
+
+// Initialize method to set the EOS strategy core and the default budgets
+void UEOSRateLimiter::Initialize(UEOSStrategyCore* EOSStrategyCore)
+{
+    EOSStrategyCorePtr = EOSStrategyCore;
+    checkf(EOSStrategyCorePtr != nullptr, TEXT("Failed to initialize EOSStrategyCore in EOSRateLimiter!"));
+
+    FRateLimitBudget AuthenticateBudget;
+    AuthenticateBudget.Capacity = 3.0f;
+    AuthenticateBudget.RefillPerSecond = 0.2f;
+    AuthenticateBudget.InteractiveReserve = 1.0f;
+    Budgets.Add(EBackendOperation::Authenticate, AuthenticateBudget);
+
+    FRateLimitBudget FindSessionsBudget;
+    FindSessionsBudget.Capacity = 4.0f;
+    FindSessionsBudget.RefillPerSecond = 0.5f;
+    FindSessionsBudget.InteractiveReserve = 2.0f;
+    Budgets.Add(EBackendOperation::FindSessions, FindSessionsBudget);
+
+    // Startup downloads a burst of files at once
+    FRateLimitBudget ReadStorageBudget;
+    ReadStorageBudget.Capacity = 32.0f;
+    ReadStorageBudget.RefillPerSecond = 8.0f;
+    ReadStorageBudget.InteractiveReserve = 4.0f;
+    Budgets.Add(EBackendOperation::ReadStorage, ReadStorageBudget);
+}
+
+void UEOSRateLimiter::SetBudget(EBackendOperation Operation, const FRateLimitBudget& Budget)
+{
+    Budgets.Add(Operation, Budget);
+}
+
+const FRateLimitBudget& UEOSRateLimiter::GetBudget(EBackendOperation Operation) const
+{
+    static const FRateLimitBudget DefaultBudget;
+    const FRateLimitBudget* Budget = Budgets.Find(Operation);
+    return Budget != nullptr ? *Budget : DefaultBudget;
+}
+
+// Adds the tokens regained since the last refill, new buckets start full
+UEOSRateLimiter::FOperationState& UEOSRateLimiter::RefillState(EBackendOperation Operation)
+{
+    const FRateLimitBudget& Budget = GetBudget(Operation);
+    const double Now = FPlatformTime::Seconds();
+
+    FOperationState* State = States.Find(Operation);
+    if (State == nullptr)
+    {
+        State = &States.Add(Operation);
+        State->Tokens = Budget.Capacity;
+        State->LastRefillTime = Now;
+        return *State;
+    }
+
+    State->Tokens = FMath::Min(Budget.Capacity, State->Tokens + static_cast<float>(Now - State->LastRefillTime) * Budget.RefillPerSecond);
+    State->LastRefillTime = Now;
+    return *State;
+}
+
+// Every lane waits for the backoff, background requests also leave the interactive reserve untouched
+float UEOSRateLimiter::GetRetryDelay(EBackendOperation Operation, ERequestPriority Priority)
+{
+    const FRateLimitBudget& Budget = GetBudget(Operation);
+    const FOperationState& State = RefillState(Operation);
+
+    float Delay = FMath::Max(0.0f, static_cast<float>(State.BackoffUntil - State.LastRefillTime));
+
+    const float Floor = Priority == ERequestPriority::Background ? Budget.InteractiveReserve : 0.0f;
+    const float Missing = Floor + 1.0f - State.Tokens;
+    if (Missing > 0.0f)
+    {
+        Delay = FMath::Max(Delay, Budget.RefillPerSecond > 0.0f ? Missing / Budget.RefillPerSecond : MAX_flt);
+    }
+    return Delay;
+}
+
+bool UEOSRateLimiter::TryAcquire(EBackendOperation Operation, ERequestPriority Priority, FString& OutError)
+{
+    const float Delay = GetRetryDelay(Operation, Priority);
+    if (Delay > 0.0f)
+    {
+        OutError = FString::Printf(TEXT("Too many requests. Please retry in %.1f seconds."), Delay);
+        UE_LOG(LogTemp, Warning, TEXT("Rate limited %s: %s"), *UEnum::GetValueAsString(Operation), *OutError);
+        return false;
+    }
+
+    States[Operation].Tokens -= 1.0f;
+    return true;
+}
+
+void UEOSRateLimiter::ReportSuccess(EBackendOperation Operation)
+{
+    FOperationState& State = RefillState(Operation);
+    State.ConsecutiveFailures = 0;
+    State.BackoffUntil = 0.0;
+}
+
+void UEOSRateLimiter::DecayBackoff()
+{
+    for (TPair<EBackendOperation, FOperationState>& State : States)
+    {
+        State.Value.ConsecutiveFailures /= 2;
+    }
+}
+
+// Exponential backoff with equal jitter, so clients recovering from an incident do not retry in lockstep
+void UEOSRateLimiter::ReportFailure(EBackendOperation Operation)
+{
+    const FRateLimitBudget& Budget = GetBudget(Operation);
+    FOperationState& State = RefillState(Operation);
+
+    State.ConsecutiveFailures = FMath::Min(State.ConsecutiveFailures + 1, 16);
+    const float Backoff = FMath::Min(Budget.MaxBackoffSeconds, Budget.BaseBackoffSeconds * FMath::Pow(2.0f, State.ConsecutiveFailures - 1));
+    const float JitteredBackoff = Backoff * 0.5f + FMath::FRandRange(0.0f, Backoff * 0.5f);
+    State.BackoffUntil = State.LastRefillTime + JitteredBackoff;
+
+    UE_LOG(LogTemp, Warning, TEXT("%s failed %d times in a row, backing off for %.1f seconds."), *UEnum::GetValueAsString(Operation), State.ConsecutiveFailures, JitteredBackoff);
+}
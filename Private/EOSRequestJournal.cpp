@@ -0,0 +1,184 @@
+/**
+ * @file EOSRequestJournal.cpp
+ *
+ * @brief Author: Marcel Gheorghe Becheanu
+ * @brief Last Updated: October 18, 2026
+ * @brief Github: https://github.com/marcelbecheanu
+ *
+ * This file contains the implementation of the UEOSRequestJournal class, which queues backend calls during outages and replays them on reconnection.
+ */
+
+#include "EOSRequestJournal.h"
+#include "EOSStrategyCore.h"
+#include "OnlineSubsystem.h"
+#include "TimerManager.h"
+
+// Initialize method to set the EOS strategy core and listen to connection changes
+void UEOSRequestJournal::Initialize(UEOSStrategyCore* EOSStrategyCore)
+{
+    EOSStrategyCorePtr = EOSStrategyCore;
+    checkf(EOSStrategyCorePtr != nullptr, TEXT("Failed to initialize EOSStrategyCore in EOSRequestJournal!"));
+
+    EOSStrategyCorePtr->GetOnlineSubsystem()->AddOnConnectionStatusChangedDelegate_Handle(
+        FOnConnectionStatusChangedDelegate::CreateUObject(this, &UEOSRequestJournal::OnConnectionStatusChanged));
+}
+
+bool UEOSRequestJournal::IsOffline() const
+{
+    return bIsOffline;
+}
+
+int32 UEOSRequestJournal::GetQueuedRequestCount() const
+{
+    return Entries.Num() + ReplayQueue.Num();
+}
+
+// A priority order, the queued calls do not depend on each other: the friends list and session searches the player
+// is looking at go first, stats writes nobody waits for go last
+int32 UEOSRequestJournal::GetReplayRank(EBackendOperation Operation)
+{
+    switch (Operation)
+    {
+    case EBackendOperation::ReadFriends:
+        return 0;
+    case EBackendOperation::FindSessions:
+        return 1;
+    default:
+        return 2;
+    }
+}
+
+bool UEOSRequestJournal::DeferIfOffline(EBackendOperation Operation, const FString& CoalesceKey, TFunction<void()>&& Replay)
+{
+    if (!bIsOffline)
+    {
+        return false;
+    }
+
+    // The latest call supersedes the queued one, e.g. a newer server list refresh
+    if (!CoalesceKey.IsEmpty())
+    {
+        Entries.RemoveAll([&CoalesceKey](const FJournalEntry& Entry) { return Entry.CoalesceKey == CoalesceKey; });
+    }
+
+    if (Entries.Num() >= FMath::Max(1, MaxQueuedRequests))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Request journal is full, dropping the oldest queued request."));
+        Entries.RemoveAt(0);
+    }
+
+    FJournalEntry& Entry = Entries.AddDefaulted_GetRef();
+    Entry.Operation = Operation;
+    Entry.CoalesceKey = CoalesceKey;
+    Entry.Replay = MoveTemp(Replay);
+    Entry.Sequence = NextSequence++;
+
+    UE_LOG(LogTemp, Log, TEXT("Offline, queued %s (%d requests queued)"), *UEnum::GetValueAsString(Operation), Entries.Num());
+    if (OnRequestQueuedDelegate.IsBound())
+    {
+        OnRequestQueuedDelegate.Broadcast(Operation, Entries.Num());
+    }
+    return true;
+}
+
+void UEOSRequestJournal::OnConnectionStatusChanged(const FString& ServiceName, EOnlineServerConnectionStatus::Type LastConnectionState, EOnlineServerConnectionStatus::Type ConnectionState)
+{
+    const bool bWasOffline = bIsOffline;
+    switch (ConnectionState)
+    {
+    case EOnlineServerConnectionStatus::Normal:
+    case EOnlineServerConnectionStatus::Connected:
+        bIsOffline = false;
+        break;
+    case EOnlineServerConnectionStatus::ConnectionDropped:
+    case EOnlineServerConnectionStatus::NoNetworkConnection:
+    case EOnlineServerConnectionStatus::ServiceUnavailable:
+    case EOnlineServerConnectionStatus::ServersTooBusy:
+        bIsOffline = true;
+        break;
+    default:
+        // Account and version problems are not outages, calls should fail instead of waiting
+        return;
+    }
+
+    if (bWasOffline == bIsOffline)
+    {
+        return;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Connection to %s %s"), *ServiceName, bIsOffline ? TEXT("lost") : TEXT("restored"));
+    if (OnConnectionStateChangedDelegate.IsBound())
+    {
+        OnConnectionStateChangedDelegate.Broadcast(!bIsOffline);
+    }
+
+    if (bIsOffline)
+    {
+        StopReplay();
+        return;
+    }
+
+    // Keep the backoff built up during the outage, a recovering backend should not see every client at full rate
+    EOSStrategyCorePtr->GetRateLimiter()->DecayBackoff();
+    if (Entries.Num() > 0 && !ReplayTimerHandle.IsValid())
+    {
+        const float StartDelay = FMath::FRandRange(0.0f, FMath::Max(0.0f, MaxReplayStartDelaySeconds));
+        UE_LOG(LogTemp, Log, TEXT("Replaying %d queued requests in %.1f seconds"), Entries.Num(), StartDelay);
+        NumReplayed = 0;
+        EOSStrategyCorePtr->GetTimerManager().SetTimer(ReplayTimerHandle, this, &UEOSRequestJournal::StartReplay, FMath::Max(StartDelay, 0.01f), false);
+    }
+}
+
+void UEOSRequestJournal::StartReplay()
+{
+    ReplayTimerHandle.Invalidate();
+
+    ReplayQueue = MoveTemp(Entries);
+    Entries.Reset();
+    ReplayQueue.StableSort([](const FJournalEntry& A, const FJournalEntry& B)
+    {
+        const int32 RankA = GetReplayRank(A.Operation);
+        const int32 RankB = GetReplayRank(B.Operation);
+        return RankA != RankB ? RankA < RankB : A.Sequence < B.Sequence;
+    });
+    ReplayNextEntry();
+}
+
+// The calls that were not replayed yet wait for the next reconnection
+void UEOSRequestJournal::StopReplay()
+{
+    EOSStrategyCorePtr->GetTimerManager().ClearTimer(ReplayTimerHandle);
+    if (ReplayQueue.Num() > 0)
+    {
+        ReplayQueue.Append(MoveTemp(Entries));
+        Entries = MoveTemp(ReplayQueue);
+        ReplayQueue.Reset();
+    }
+}
+
+void UEOSRequestJournal::ReplayNextEntry()
+{
+    ReplayTimerHandle.Invalidate();
+
+    while (ReplayQueue.Num() > 0 && !bIsOffline)
+    {
+        // Wait for the budget the replayed call will ask for, it acquires it itself
+        const float Delay = EOSStrategyCorePtr->GetRateLimiter()->GetRetryDelay(ReplayQueue[0].Operation, ERequestPriority::Background);
+        if (Delay > 0.0f)
+        {
+            EOSStrategyCorePtr->GetTimerManager().SetTimer(ReplayTimerHandle, this, &UEOSRequestJournal::ReplayNextEntry, Delay, false);
+            return;
+        }
+
+        // A replayed call may find the connection gone again and queue itself back
+        FJournalEntry Entry = MoveTemp(ReplayQueue[0]);
+        ReplayQueue.RemoveAt(0);
+        ++NumReplayed;
+        Entry.Replay();
+    }
+
+    if (ReplayQueue.Num() == 0 && !bIsOffline && OnRequestJournalReplayedDelegate.IsBound())
+    {
+        OnRequestJournalReplayedDelegate.Broadcast(NumReplayed);
+    }
+}
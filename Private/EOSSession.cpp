@@ -9,81 +9,476 @@
 
 #include "EOSSession.h"
 #include "OnlineSessionSettings.h"
+#include "EOSSessionPresets.h"
 #include "EOSStrategyCore.h"
 
 #include "Interfaces/OnlineSessionInterface.h"
 #include "Kismet/GameplayStatics.h"
+#include "Algo/Sort.h"
+#include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "TimerManager.h"
+
+namespace EOSSessionCache
+{
+	// Identifies the server list cache file ('EOSC')
+	static constexpr uint32 Magic = 0x43534F45;
+
+	// Bumped whenever the layout below changes, older files are discarded
+	static constexpr int32 Version = 1;
+
+	// Upper bound for entries per list, guards against corrupted files
+	static constexpr int32 MaxEntries = 100000;
+
+	static void SerializeServer(FArchive& Ar, FSessionServer& Server)
+	{
+		int64 LastSeenTicks = Server.LastSeen.GetTicks();
+		Ar << Server.ID << Server.Name << Server.World << Server.Ping << Server.CurrentPlayers << Server.MaxPlayers << LastSeenTicks;
+
+		if (Ar.IsLoading())
+		{
+			Server.LastSeen = FDateTime(LastSeenTicks);
+			Server.bIsCached = true;
+			Server.Fingerprint = Server.ComputeFingerprint();
+		}
+	}
+
+	static bool SerializeServers(FArchive& Ar, TArray<FSessionServer>& Servers)
+	{
+		int32 Num = Servers.Num();
+		Ar << Num;
+		if (Ar.IsLoading())
+		{
+			if (Ar.IsError() || Num < 0 || Num > MaxEntries)
+			{
+				return false;
+			}
+			Servers.SetNum(Num);
+		}
+
+		for (FSessionServer& Server : Servers)
+		{
+			SerializeServer(Ar, Server);
+		}
+		return !Ar.IsError();
+	}
+
+	static bool Serialize(FArchive& Ar, FSessionServerCache& Cache)
+	{
+		uint32 FileMagic = Magic;
+		int32 FileVersion = Version;
+		Ar << FileMagic << FileVersion;
+		if (Ar.IsError() || FileMagic != Magic || FileVersion != Version)
+		{
+			return false;
+		}
+
+		int64 SavedAtTicks = Cache.SavedAt.GetTicks();
+		Ar << SavedAtTicks;
+		Cache.SavedAt = FDateTime(SavedAtTicks);
+
+		return SerializeServers(Ar, Cache.Servers)
+			&& SerializeServers(Ar, Cache.FavoriteServers)
+			&& SerializeServers(Ar, Cache.RecentServers);
+	}
+
+	// Reads the cache file, memory-mapping it when the platform supports it.
+	static TSharedPtr<FSessionServerCache, ESPMode::ThreadSafe> Load(const FString& Path)
+	{
+		TSharedPtr<FSessionServerCache, ESPMode::ThreadSafe> Cache = MakeShared<FSessionServerCache, ESPMode::ThreadSafe>();
+
+		TUniquePtr<IMappedFileHandle> MappedFile(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Path));
+		if (MappedFile.IsValid() && MappedFile->GetFileSize() > 0)
+		{
+			TUniquePtr<IMappedFileRegion> MappedRegion(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+			if (MappedRegion.IsValid())
+			{
+				FMemoryReaderView Reader(MakeArrayView(MappedRegion->GetMappedPtr(), static_cast<int32>(MappedRegion->GetMappedSize())));
+				return Serialize(Reader, *Cache) ? Cache : nullptr;
+			}
+		}
+
+		TArray<uint8> Data;
+		if (!FFileHelper::LoadFileToArray(Data, *Path, FILEREAD_Silent))
+		{
+			return nullptr;
+		}
+		FMemoryReader Reader(Data);
+		return Serialize(Reader, *Cache) ? Cache : nullptr;
+	}
+}
 
 void UEOSSession::Initialize(UEOSStrategyCore* EOSStrategyCore)
 {
 	EOSStrategyCorePtr = EOSStrategyCore;
 	checkf(EOSStrategyCorePtr != nullptr, TEXT("Failed to initialize EOSStrategyCore in EOSSession!"));
+
+	LoadServerCacheAsync();
+}
+
+FString UEOSSession::GetServerCachePath() const
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EOSStrategy"), TEXT("ServerCache.bin"));
+}
+
+void UEOSSession::LoadServerCacheAsync()
+{
+	TWeakObjectPtr<UEOSSession> WeakThis(this);
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Path = GetServerCachePath()]()
+	{
+		TSharedPtr<FSessionServerCache, ESPMode::ThreadSafe> Cache = EOSSessionCache::Load(Path);
+
+		// Report back even without a cache, saves are held until the load is over
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Cache]()
+		{
+			UEOSSession* Session = WeakThis.Get();
+			if (Session == nullptr)
+			{
+				return;
+			}
+
+			Session->bIsServerCacheLoaded = true;
+			if (Cache.IsValid())
+			{
+				Session->ApplyServerCache(*Cache);
+			}
+
+			// Write what changed during the load merged with the loaded lists
+			if (Session->bIsServerCacheDirty)
+			{
+				Session->SaveServerCache();
+			}
+		});
+	});
+}
+
+void UEOSSession::ApplyServerCache(const FSessionServerCache& Cache)
+{
+	// Keep anything the player changed while the cache was loading
+	for (const FSessionServer& Favorite : Cache.FavoriteServers)
+	{
+		if (!IsFavoriteServer(Favorite.ID))
+		{
+			FavoriteServers.Add(Favorite);
+		}
+	}
+	for (const FSessionServer& Recent : Cache.RecentServers)
+	{
+		if (RecentServers.Num() < MaxRecentServers && !RecentServers.ContainsByPredicate([&Recent](const FSessionServer& Server) { return Server.ID == Recent.ID; }))
+		{
+			RecentServers.Add(Recent);
+		}
+	}
+
+	// A live search already replaced the cached list
+	if (bHasLiveSessionServers)
+	{
+		return;
+	}
+
+	// Seed the delta with the cached list so the first live search reconciles it
+	KnownSessionServers.Empty(Cache.Servers.Num());
+	for (const FSessionServer& Server : Cache.Servers)
+	{
+		KnownSessionServers.Add(Server.ID, Server);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Loaded %d cached sessions saved at %s"), Cache.Servers.Num(), *Cache.SavedAt.ToString());
+	if (OnCachedOnlineSessionsLoadedDelegate.IsBound())
+	{
+		OnCachedOnlineSessionsLoadedDelegate.Broadcast(Cache.Servers, Cache.SavedAt);
+	}
+}
+
+void UEOSSession::SaveServerCache()
+{
+	// Only one write runs at a time, changes made meanwhile are written once it completes. Nothing is
+	// written before the load completes, it would replace the lists on disk with the partial ones in memory
+	if (bIsSavingServerCache || !bIsServerCacheLoaded)
+	{
+		bIsServerCacheDirty = true;
+		return;
+	}
+	bIsSavingServerCache = true;
+	bIsServerCacheDirty = false;
+
+	FSessionServerCache Cache;
+	Cache.SavedAt = FDateTime::UtcNow();
+	Cache.FavoriteServers = FavoriteServers;
+	Cache.RecentServers = RecentServers;
+	KnownSessionServers.GenerateValueArray(Cache.Servers);
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	EOSSessionCache::Serialize(Writer, Cache);
+
+	// Write off the game thread, the buffer is already detached from the session
+	TWeakObjectPtr<UEOSSession> WeakThis(this);
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Data = MoveTemp(Data), Path = GetServerCachePath()]()
+	{
+		// Write a temporary file and swap it in, so an interrupted write never leaves a torn cache behind
+		const FString TempPath = Path + TEXT(".tmp");
+		if (!FFileHelper::SaveArrayToFile(Data, *TempPath) || !IFileManager::Get().Move(*Path, *TempPath, true))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Failed to save server list cache to %s"), *Path);
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis]()
+		{
+			if (UEOSSession* Session = WeakThis.Get())
+			{
+				Session->OnServerCacheSaved();
+			}
+		});
+	});
+}
+
+void UEOSSession::OnServerCacheSaved()
+{
+	bIsSavingServerCache = false;
+	if (bIsServerCacheDirty)
+	{
+		SaveServerCache();
+	}
+}
+
+void UEOSSession::AddFavoriteServer(const FSessionServer& SessionServer)
+{
+	if (SessionServer.ID.IsEmpty() || IsFavoriteServer(SessionServer.ID))
+	{
+		return;
+	}
+
+	FavoriteServers.Add(SessionServer);
+	SaveServerCache();
+}
+
+void UEOSSession::RemoveFavoriteServer(const FString& ServerID)
+{
+	if (FavoriteServers.RemoveAll([&ServerID](const FSessionServer& Server) { return Server.ID == ServerID; }) > 0)
+	{
+		SaveServerCache();
+	}
+}
+
+bool UEOSSession::IsFavoriteServer(const FString& ServerID) const
+{
+	return FavoriteServers.ContainsByPredicate([&ServerID](const FSessionServer& Server) { return Server.ID == ServerID; });
+}
+
+TArray<FSessionServer> UEOSSession::GetFavoriteServers() const
+{
+	return FavoriteServers;
 }
 
-void UEOSSession::CreateOnlineSession(FSessionInfo SessionInfo)
+TArray<FSessionServer> UEOSSession::GetRecentServers() const
+{
+	return RecentServers;
+}
+
+void UEOSSession::CreateOnlineSession(const FSessionInfo& SessionInfo)
 {
 	SessionInfoPtr = SessionInfo;
 
+	if (!CanCreateOnlineSession(SessionInfo.ConnectionSettings))
+	{
+		return;
+	}
+
+	FOnlineSessionSettings SessionCreationInfo;
+	BuildOnlineSessionSettings(SessionInfo, SessionCreationInfo);
+	StartCreateOnlineSession(SessionCreationInfo);
+}
+void UEOSSession::CreateOnlineSessionFromPreset(FName PresetName, const FString& SessionName)
+{
+	const FSessionPreset* Preset = SessionPresets.Find(PresetName);
+	if (Preset == nullptr)
+	{
+		HandleSessionCreationFailure(FString::Printf(TEXT("Session preset %s is not registered."), *PresetName.ToString()));
+		return;
+	}
+
+	SessionInfoPtr = Preset->SessionInfo;
+	if (!SessionName.IsEmpty())
+	{
+		SessionInfoPtr.SessionName = SessionName;
+	}
+	if (!CanCreateOnlineSession(Preset->SessionInfo.ConnectionSettings))
+	{
+		return;
+	}
+
+	// The preset settings are shared and never modified, a different name is applied to a copy. CreateSession keeps its
+	// own copy of the settings either way, so a custom name costs one more copy, not a rebuild
+	if (SessionInfoPtr.SessionName == Preset->SessionInfo.SessionName)
+	{
+		StartCreateOnlineSession(*Preset->Settings);
+		return;
+	}
+
+	FOnlineSessionSettings SessionSettings = *Preset->Settings;
+	SessionSettings.Set(FName("NAME"), SessionInfoPtr.SessionName, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	StartCreateOnlineSession(SessionSettings);
+}
+bool UEOSSession::CanCreateOnlineSession(const FConnectionSettings& ConnectionSettings) const
+{
 	if (!EOSStrategyCorePtr->HasOnlineSubsystem())
 	{
 		HandleSessionCreationFailure("Online subsystem not available.");
-		return;
+		return false;
 	}
 	if (!EOSStrategyCorePtr->HasOnlineSession())
 	{
 		HandleSessionCreationFailure("Online Session is not available.");
-		return;
+		return false;
 	}
-	if (!SessionInfo.ConnectionSettings.bIsDedicated)
+	if (!ConnectionSettings.bIsDedicated)
 	{
 		if (!EOSStrategyCorePtr->HasOnlineIdentity())
 		{
 			HandleSessionCreationFailure("Online Identity not available.");
-			return;
+			return false;
 		}
 
 		if (!EOSStrategyCorePtr->GetAuthenticator()->IsAuthenticated())
 		{
 			HandleSessionCreationFailure("Player is not authenticated.");
-			return;
+			return false;
 		}
 	}
 
-	FGuid UUID = FGuid::NewGuid();
-	FString UUIDString = UUID.ToString();
-	
-	FOnlineSessionSettings SessionCreationInfo;
-	SessionCreationInfo.bAllowInvites = SessionInfo.ConnectionSettings.bAllowInvites;
-	SessionCreationInfo.bAllowJoinInProgress = SessionInfo.ConnectionSettings.bAllowJoinInProgress;
-	SessionCreationInfo.bAllowJoinViaPresence = SessionInfo.ConnectionSettings.bAllowJoinViaPresence;
-	SessionCreationInfo.bAllowJoinViaPresenceFriendsOnly = SessionInfo.ConnectionSettings.bAllowJoinViaPresenceFriendsOnly;
-	SessionCreationInfo.bAntiCheatProtected = SessionInfo.ConnectionSettings.bAntiCheatProtected;
-	SessionCreationInfo.bIsDedicated = SessionInfo.ConnectionSettings.bIsDedicated;
-	SessionCreationInfo.bIsLANMatch = SessionInfo.ConnectionSettings.bIsLANMatch;
-	SessionCreationInfo.bShouldAdvertise = SessionInfo.ConnectionSettings.bShouldAdvertise;
-	SessionCreationInfo.bUseLobbiesIfAvailable = SessionInfo.ConnectionSettings.bUseLobbiesIfAvailable;
-	SessionCreationInfo.bUsesPresence = SessionInfo.ConnectionSettings.bUsesPresence;
-	SessionCreationInfo.bUsesStats = SessionInfo.ConnectionSettings.bUsesStats;
-	SessionCreationInfo.NumPrivateConnections = SessionInfo.ConnectionSettings.NumPrivateConnections;
-	SessionCreationInfo.NumPublicConnections = SessionInfo.ConnectionSettings.NumPublicConnections;
-	SessionCreationInfo.BuildUniqueId = SessionInfo.ConnectionSettings.BuildUniqueId;
+	FString RateLimitError;
+	if (!EOSStrategyCorePtr->GetRateLimiter()->TryAcquire(EBackendOperation::CreateSession, ERequestPriority::Interactive, RateLimitError))
+	{
+		HandleSessionCreationFailure(RateLimitError);
+		return false;
+	}
+	return true;
+}
+void UEOSSession::BuildOnlineSessionSettings(const FSessionInfo& SessionInfo, FOnlineSessionSettings& OutSessionSettings)
+{
+	OutSessionSettings.bAllowInvites = SessionInfo.ConnectionSettings.bAllowInvites;
+	OutSessionSettings.bAllowJoinInProgress = SessionInfo.ConnectionSettings.bAllowJoinInProgress;
+	OutSessionSettings.bAllowJoinViaPresence = SessionInfo.ConnectionSettings.bAllowJoinViaPresence;
+	OutSessionSettings.bAllowJoinViaPresenceFriendsOnly = SessionInfo.ConnectionSettings.bAllowJoinViaPresenceFriendsOnly;
+	OutSessionSettings.bAntiCheatProtected = SessionInfo.ConnectionSettings.bAntiCheatProtected;
+	OutSessionSettings.bIsDedicated = SessionInfo.ConnectionSettings.bIsDedicated;
+	OutSessionSettings.bIsLANMatch = SessionInfo.ConnectionSettings.bIsLANMatch;
+	OutSessionSettings.bShouldAdvertise = SessionInfo.ConnectionSettings.bShouldAdvertise;
+	OutSessionSettings.bUseLobbiesIfAvailable = SessionInfo.ConnectionSettings.bUseLobbiesIfAvailable;
+	OutSessionSettings.bUsesPresence = SessionInfo.ConnectionSettings.bUsesPresence;
+	OutSessionSettings.bUsesStats = SessionInfo.ConnectionSettings.bUsesStats;
+	OutSessionSettings.NumPrivateConnections = SessionInfo.ConnectionSettings.NumPrivateConnections;
+	OutSessionSettings.NumPublicConnections = SessionInfo.ConnectionSettings.NumPublicConnections;
+	OutSessionSettings.BuildUniqueId = SessionInfo.ConnectionSettings.BuildUniqueId;
 
 	// TODO: Permitir adicionar Chaves de pesquisa.
 	
-	SessionCreationInfo.Settings.Add(FName("NAME"), FOnlineSessionSetting((FString(SessionInfo.SessionName)), EOnlineDataAdvertisementType::ViaOnlineServiceAndPing));
-	SessionCreationInfo.Settings.Add(FName("WORLD"), FOnlineSessionSetting((FString(SessionInfo.WorldName)), EOnlineDataAdvertisementType::ViaOnlineServiceAndPing));
+	OutSessionSettings.Settings.Add(FName("NAME"), FOnlineSessionSetting((FString(SessionInfo.SessionName)), EOnlineDataAdvertisementType::ViaOnlineServiceAndPing));
+	OutSessionSettings.Settings.Add(FName("WORLD"), FOnlineSessionSetting((FString(SessionInfo.WorldName)), EOnlineDataAdvertisementType::ViaOnlineServiceAndPing));
+	OutSessionSettings.Settings.Add(FName("REGION"), FOnlineSessionSetting((FString(SessionInfo.Region)), EOnlineDataAdvertisementType::ViaOnlineServiceAndPing));
+	OutSessionSettings.Settings.Add(FName("BUILD"), FOnlineSessionSetting(SessionInfo.ConnectionSettings.BuildUniqueId, EOnlineDataAdvertisementType::ViaOnlineService));
+}
+void UEOSSession::StartCreateOnlineSession(const FOnlineSessionSettings& SessionSettings)
+{
+	FGuid UUID = FGuid::NewGuid();
+	FString UUIDString = UUID.ToString();
 
 	EOSStrategyCorePtr->GetOnlineSession()->OnCreateSessionCompleteDelegates.AddUObject(this, &UEOSSession::OnCreateOnlineSessionCompleted);
-	EOSStrategyCorePtr->GetOnlineSession()->CreateSession(0, FName(UUIDString), SessionCreationInfo);
+	EOSStrategyCorePtr->GetOnlineSession()->CreateSession(0, FName(UUIDString), SessionSettings);
+}
+bool UEOSSession::ValidateSessionInfo(const FSessionInfo& SessionInfo, FString& OutError)
+{
+	const FConnectionSettings& ConnectionSettings = SessionInfo.ConnectionSettings;
+	if (SessionInfo.WorldPath.IsEmpty())
+	{
+		OutError = "World path is empty.";
+		return false;
+	}
+	if (SessionInfo.PortServer <= 0 || SessionInfo.PortServer > 65535)
+	{
+		OutError = FString::Printf(TEXT("Server port %d is out of range."), SessionInfo.PortServer);
+		return false;
+	}
+	if (ConnectionSettings.NumPublicConnections < 0 || ConnectionSettings.NumPrivateConnections < 0)
+	{
+		OutError = "Number of connections cannot be negative.";
+		return false;
+	}
+	if (ConnectionSettings.NumPublicConnections + ConnectionSettings.NumPrivateConnections == 0)
+	{
+		OutError = "Session has no public or private connections.";
+		return false;
+	}
+	return true;
+}
+bool UEOSSession::ValidateSearchSettings(const FSearchSettings& SearchSettings, FString& OutError)
+{
+	if (SearchSettings.MaxSearchResults <= 0)
+	{
+		OutError = "Max search results must be greater than zero.";
+		return false;
+	}
+	if (SearchSettings.PingBucketSize < 0 || SearchSettings.TimeoutInSeconds < 0.0f)
+	{
+		OutError = "Ping bucket size and timeout cannot be negative.";
+		return false;
+	}
+	return true;
+}
+bool UEOSSession::RegisterSessionPresets(const UEOSSessionPresetAsset* PresetAsset)
+{
+	if (PresetAsset == nullptr)
+	{
+		return false;
+	}
+
+	// Presets are validated and built once here, so errors show up at load time rather than when a session is created
+	bool bAllValid = true;
+	for (const TPair<FName, FSessionInfo>& Entry : PresetAsset->SessionPresets)
+	{
+		FString ValidationError;
+		if (!ValidateSessionInfo(Entry.Value, ValidationError))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Invalid session preset %s in %s: %s"), *Entry.Key.ToString(), *PresetAsset->GetName(), *ValidationError);
+			bAllValid = false;
+			continue;
+		}
+
+		const TSharedRef<FOnlineSessionSettings> Settings = MakeShared<FOnlineSessionSettings>();
+		BuildOnlineSessionSettings(Entry.Value, *Settings);
+		SessionPresets.Add(Entry.Key, FSessionPreset{ Entry.Value, Settings });
+	}
+	for (const TPair<FName, FSearchSettings>& Entry : PresetAsset->SearchPresets)
+	{
+		FString ValidationError;
+		if (!ValidateSearchSettings(Entry.Value, ValidationError))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Invalid search preset %s in %s: %s"), *Entry.Key.ToString(), *PresetAsset->GetName(), *ValidationError);
+			bAllValid = false;
+			continue;
+		}
+
+		SearchPresets.Add(Entry.Key, Entry.Value);
+	}
+	return bAllValid;
 }
 void UEOSSession::OnCreateOnlineSessionCompleted(FName SessionName, bool bWasSuccessful)
 {
 	EOSStrategyCorePtr->GetOnlineSession()->ClearOnCreateSessionCompleteDelegates(this);
 	if (!bWasSuccessful)
 	{
+		EOSStrategyCorePtr->GetRateLimiter()->ReportFailure(EBackendOperation::CreateSession);
 		HandleSessionCreationFailure("Failed to create online session.");
 		return;
 	}
+	EOSStrategyCorePtr->GetRateLimiter()->ReportSuccess(EBackendOperation::CreateSession);
 
 	bool bHasHosted = EOSStrategyCorePtr->GetWorld()->ServerTravel(FString(SessionInfoPtr.WorldPath + "?listen?port=" + FString::FromInt(SessionInfoPtr.PortServer)));
 	if (OnCreateOnlineSessionCompletedDelegate.IsBound())
@@ -100,7 +495,20 @@ void UEOSSession::HandleSessionCreationFailure(const FString& ErrorMessage) cons
 	}
 }
 
-void UEOSSession::FindOnlineSessions(FSearchSettings SearchSettings)
+void UEOSSession::FindOnlineSessionsFromPreset(FName PresetName)
+{
+	const FSearchSettings* SearchSettings = SearchPresets.Find(PresetName);
+	if (SearchSettings == nullptr)
+	{
+		HandleFindOnlineSessionsFailure(FString::Printf(TEXT("Search preset %s is not registered."), *PresetName.ToString()));
+		return;
+	}
+
+	// The search object also receives the results, so unlike session presets it is built for every search
+
+	FindOnlineSessions(*SearchSettings);
+}
+void UEOSSession::FindOnlineSessions(const FSearchSettings& SearchSettings)
 {
 	if (!EOSStrategyCorePtr->HasOnlineSubsystem())
 	{
@@ -117,44 +525,155 @@ void UEOSSession::FindOnlineSessions(FSearchSettings SearchSettings)
 		HandleFindOnlineSessionsFailure("Player authentication failed. Please log in to your account.");
 		return;
 	}
+	if (IsSessionSearchInProgress())
+	{
+		HandleFindOnlineSessionsFailure("A session search is already in progress.");
+		return;
+	}
 
-	OnlineSessionSearch = MakeShareable(new FOnlineSessionSearch());
-	OnlineSessionSearch->bIsLanQuery = SearchSettings.bIsLanQuery;
-	OnlineSessionSearch->PingBucketSize = SearchSettings.PingBucketSize;
-	OnlineSessionSearch->MaxSearchResults = SearchSettings.MaxSearchResults;
-	OnlineSessionSearch->TimeoutInSeconds = SearchSettings.TimeoutInSeconds;
-	OnlineSessionSearch->PlatformHash = SearchSettings.PlatformHash;
+	// While offline only the latest search is kept and replayed on reconnection
+	TWeakObjectPtr<UEOSSession> WeakThis(this);
+	if (EOSStrategyCorePtr->GetRequestJournal()->DeferIfOffline(EBackendOperation::FindSessions, TEXT("FindSessions"), [WeakThis, SearchSettings]()
+	{
+		if (UEOSSession* Session = WeakThis.Get())
+		{
+			Session->FindOnlineSessions(SearchSettings);
+		}
+	}))
+	{
+		HandleFindOnlineSessionsFailure("Queued while offline, the search runs once the connection is restored.");
+		return;
+	}
 
-	// TODO: Permitir pesquisa por chaves.
-	
-	OnlineSessionSearch->QuerySettings.SearchParams.Empty();
+	// Background refreshes never use the budget kept for the player
+	FString RateLimitError;
+	const ERequestPriority Priority = SearchSettings.bIsBackgroundRefresh ? ERequestPriority::Background : ERequestPriority::Interactive;
+	if (!EOSStrategyCorePtr->GetRateLimiter()->TryAcquire(EBackendOperation::FindSessions, Priority, RateLimitError))
+	{
+		HandleFindOnlineSessionsFailure(RateLimitError);
+		return;
+	}
+
+	OnlineSessionSearch = MakeOnlineSessionSearch(SearchSettings);
 	EOSStrategyCorePtr->GetOnlineSession()->FindSessions(0, OnlineSessionSearch.ToSharedRef());
 	EOSStrategyCorePtr->GetOnlineSession()->OnFindSessionsCompleteDelegates.AddUObject(this, &UEOSSession::OnFindOnlineSessionsCompleted);
 }
+TSharedRef<FOnlineSessionSearch> UEOSSession::MakeOnlineSessionSearch(const FSearchSettings& SearchSettings) const
+{
+	TSharedRef<FOnlineSessionSearch> Search = MakeShareable(new FOnlineSessionSearch());
+	Search->bIsLanQuery = SearchSettings.bIsLanQuery;
+	Search->PingBucketSize = SearchSettings.PingBucketSize;
+	Search->MaxSearchResults = SearchSettings.MaxSearchResults;
+	Search->TimeoutInSeconds = SearchSettings.TimeoutInSeconds;
+	Search->PlatformHash = SearchSettings.PlatformHash;
+
+	// TODO: Permitir pesquisa por chaves.
+	
+	Search->QuerySettings.SearchParams.Empty();
+	return Search;
+}
+bool UEOSSession::IsSessionSearchInProgress() const
+{
+	return ShardSearches.Num() > 0 || (OnlineSessionSearch.IsValid() && OnlineSessionSearch->SearchState == EOnlineAsyncTaskState::InProgress);
+}
 void UEOSSession::OnFindOnlineSessionsCompleted(bool bWasSuccess)
 {
+	// The delegate is shared by every search, ignore completions while our search is still running
+	if (!OnlineSessionSearch.IsValid() || OnlineSessionSearch->SearchState == EOnlineAsyncTaskState::InProgress)
+	{
+		return;
+	}
 	EOSStrategyCorePtr->GetOnlineSession()->ClearOnFindSessionsCompleteDelegates(this);
 	UE_LOG(LogTemp, Warning, TEXT("Online Session Search Completed: %s"), bWasSuccess ? TEXT("Success") : TEXT("Failed"));
 	UE_LOG(LogTemp, Warning, TEXT("Number of Sessions Found: %d"), OnlineSessionSearch->SearchResults.Num());
 
 	if(!bWasSuccess)
 	{
+		EOSStrategyCorePtr->GetRateLimiter()->ReportFailure(EBackendOperation::FindSessions);
 		HandleFindOnlineSessionsFailure("Failed to find online sessions.");
 		return;
 	}
+	EOSStrategyCorePtr->GetRateLimiter()->ReportSuccess(EBackendOperation::FindSessions);
 
 	// Success: Process search results
 	TArray<FSessionServer> Servers;
+	Servers.Reserve(OnlineSessionSearch->SearchResults.Num());
 	for (const FOnlineSessionSearchResult& SearchResult : OnlineSessionSearch->SearchResults)
 	{
 		Servers.Add(FSessionServer(SearchResult));
 	}
-	
+
+	PublishSessionServers(Servers);
+}
+void UEOSSession::PublishSessionServers(const TArray<FSessionServer>& Servers)
+{
+	BroadcastSessionServers(Servers);
+	UpdateKnownSessionServers(Servers);
+}
+void UEOSSession::BroadcastSessionServers(const TArray<FSessionServer>& Servers) const
+{
 	if (OnFindOnlineSessionCompletedDelegate.IsBound())
 	{
 		OnFindOnlineSessionCompletedDelegate.Broadcast(Servers, false, "Success!");
 	}
 }
+void UEOSSession::UpdateKnownSessionServers(const TArray<FSessionServer>& Servers)
+{
+	// Diff against the previous results so list views only touch the affected rows
+	TArray<FSessionServer> Added;
+	TArray<FSessionServer> Changed;
+	TArray<FString> Removed;
+
+	TMap<FString, FSessionServer> CurrentSessionServers;
+	CurrentSessionServers.Reserve(Servers.Num());
+	for (const FSessionServer& Server : Servers)
+	{
+		if (CurrentSessionServers.Contains(Server.ID))
+		{
+			continue;
+		}
+
+		const FSessionServer* Previous = KnownSessionServers.Find(Server.ID);
+		if (Previous == nullptr)
+		{
+			Added.Add(Server);
+		}
+		else if (Previous->Fingerprint != Server.Fingerprint)
+		{
+			Changed.Add(Server);
+		}
+		CurrentSessionServers.Add(Server.ID, Server);
+	}
+	for (const TPair<FString, FSessionServer>& Known : KnownSessionServers)
+	{
+		if (!CurrentSessionServers.Contains(Known.Key))
+		{
+			Removed.Add(Known.Key);
+		}
+	}
+	KnownSessionServers = MoveTemp(CurrentSessionServers);
+	bHasLiveSessionServers = true;
+
+	// Refresh the favorites with the live data, they stay cached if the server is not listed anymore
+	for (FSessionServer& Favorite : FavoriteServers)
+	{
+		if (const FSessionServer* Live = KnownSessionServers.Find(Favorite.ID))
+		{
+			Favorite = *Live;
+		}
+	}
+	SaveServerCache();
+
+	UE_LOG(LogTemp, Log, TEXT("Session Delta: %d added, %d changed, %d removed"), Added.Num(), Changed.Num(), Removed.Num());
+	if (OnFindOnlineSessionDeltaDelegate.IsBound())
+	{
+		OnFindOnlineSessionDeltaDelegate.Broadcast(Added, Changed, Removed);
+	}
+}
+void UEOSSession::ResetSessionDelta()
+{
+	KnownSessionServers.Empty();
+}
 void UEOSSession::HandleFindOnlineSessionsFailure(const FString& ErrorMessage) const
 {
 	UE_LOG(LogTemp, Error, TEXT("%s"), *ErrorMessage);
@@ -165,6 +684,358 @@ void UEOSSession::HandleFindOnlineSessionsFailure(const FString& ErrorMessage) c
 	}
 }
 
+namespace EOSSessionShards
+{
+	// Strict weak ordering of session servers for a sort key, ties are broken by ID so merges are stable
+	static bool IsBefore(const FSessionServer& A, const FSessionServer& B, ESessionSortKey SortKey)
+	{
+		switch (SortKey)
+		{
+		case ESessionSortKey::Players:
+			if (A.CurrentPlayers != B.CurrentPlayers) return A.CurrentPlayers > B.CurrentPlayers;
+			break;
+		case ESessionSortKey::OpenSlots:
+			if (A.MaxPlayers - A.CurrentPlayers != B.MaxPlayers - B.CurrentPlayers) return A.MaxPlayers - A.CurrentPlayers > B.MaxPlayers - B.CurrentPlayers;
+			break;
+		case ESessionSortKey::Name:
+			if (A.Name != B.Name) return A.Name < B.Name;
+			break;
+		default:
+			if (A.Ping != B.Ping) return A.Ping < B.Ping;
+			break;
+		}
+		return A.ID < B.ID;
+	}
+
+	// Position in the sorted results of one shard during the k-way merge
+	struct FMergeCursor
+	{
+		int32 ShardIndex;
+		int32 ResultIndex;
+	};
+}
+
+void UEOSSession::FindShardedOnlineSessions(const FShardedSearchSettings& InShardedSearchSettings)
+{
+	if (!EOSStrategyCorePtr->HasOnlineSubsystem())
+	{
+		HandleFindOnlineSessionsFailure("Online subsystem not available.");
+		return;
+	}
+	if (!EOSStrategyCorePtr->HasOnlineSession())
+	{
+		HandleFindOnlineSessionsFailure("Online Session is not available.");
+		return;
+	}
+	if (!EOSStrategyCorePtr->GetAuthenticator()->IsAuthenticated())
+	{
+		HandleFindOnlineSessionsFailure("Player authentication failed. Please log in to your account.");
+		return;
+	}
+	if (InShardedSearchSettings.Shards.Num() == 0)
+	{
+		FindOnlineSessions(InShardedSearchSettings.SearchSettings);
+		return;
+	}
+	if (IsSessionSearchInProgress())
+	{
+		HandleFindOnlineSessionsFailure("A session search is already in progress.");
+		return;
+	}
+
+	TWeakObjectPtr<UEOSSession> WeakThis(this);
+	if (EOSStrategyCorePtr->GetRequestJournal()->DeferIfOffline(EBackendOperation::FindSessions, TEXT("FindSessions"), [WeakThis, InShardedSearchSettings]()
+	{
+		if (UEOSSession* Session = WeakThis.Get())
+		{
+			Session->FindShardedOnlineSessions(InShardedSearchSettings);
+		}
+	}))
+	{
+		HandleFindOnlineSessionsFailure("Queued while offline, the search runs once the connection is restored.");
+		return;
+	}
+
+	// The whole fan-out counts as a single search against the budget
+	FString RateLimitError;
+	const ERequestPriority Priority = InShardedSearchSettings.SearchSettings.bIsBackgroundRefresh ? ERequestPriority::Background : ERequestPriority::Interactive;
+	if (!EOSStrategyCorePtr->GetRateLimiter()->TryAcquire(EBackendOperation::FindSessions, Priority, RateLimitError))
+	{
+		HandleFindOnlineSessionsFailure(RateLimitError);
+		return;
+	}
+
+	ShardedSearchSettings = InShardedSearchSettings;
+	ShardSearches.SetNum(ShardedSearchSettings.Shards.Num());
+	for (int32 Index = 0; Index < ShardSearches.Num(); ++Index)
+	{
+		FShardSearch& ShardSearch = ShardSearches[Index];
+		ShardSearch.Shard = ShardedSearchSettings.Shards[Index];
+		ShardSearch.Search = MakeOnlineSessionSearch(ShardedSearchSettings.SearchSettings);
+
+		FOnlineSearchSettings& QuerySettings = ShardSearch.Search->QuerySettings;
+		if (!ShardSearch.Shard.Region.IsEmpty())
+		{
+			QuerySettings.Set(FName("REGION"), ShardSearch.Shard.Region, EOnlineComparisonOp::Equals);
+		}
+		if (!ShardSearch.Shard.World.IsEmpty())
+		{
+			QuerySettings.Set(FName("WORLD"), ShardSearch.Shard.World, EOnlineComparisonOp::Equals);
+		}
+		if (ShardSearch.Shard.BuildUniqueId != 0)
+		{
+			QuerySettings.Set(FName("BUILD"), ShardSearch.Shard.BuildUniqueId, EOnlineComparisonOp::Equals);
+		}
+	}
+
+	bHasDeliveredShardedResults = false;
+	ShardedSearchDelegateHandle = EOSStrategyCorePtr->GetOnlineSession()->AddOnFindSessionsCompleteDelegate_Handle(
+		FOnFindSessionsCompleteDelegate::CreateUObject(this, &UEOSSession::OnShardSearchCompleted));
+	if (ShardedSearchSettings.ShardTimeoutSeconds > 0.0f)
+	{
+		EOSStrategyCorePtr->GetTimerManager().SetTimer(ShardDeadlineTimerHandle, this, &UEOSSession::OnShardedSearchDeadline, ShardedSearchSettings.ShardTimeoutSeconds, false);
+	}
+	LaunchShardSearches();
+}
+void UEOSSession::LaunchShardSearches()
+{
+	int32 NumInFlight = 0;
+	for (const FShardSearch& ShardSearch : ShardSearches)
+	{
+		NumInFlight += ShardSearch.bInFlight ? 1 : 0;
+	}
+
+	const int32 MaxConcurrentShards = FMath::Max(1, ShardedSearchSettings.MaxConcurrentShards);
+	bIsLaunchingShards = true;
+	for (FShardSearch& ShardSearch : ShardSearches)
+	{
+		if (NumInFlight >= MaxConcurrentShards)
+		{
+			break;
+		}
+		if (ShardSearch.bInFlight || ShardSearch.bDone)
+		{
+			continue;
+		}
+
+		// The stock session interfaces accept but ignore a search while another one is pending, it then stays NotStarted
+		ShardSearch.bInFlight = true;
+		const bool bAccepted = EOSStrategyCorePtr->GetOnlineSession()->FindSessions(0, ShardSearch.Search.ToSharedRef());
+		if (bAccepted && ShardSearch.Search->SearchState != EOnlineAsyncTaskState::NotStarted)
+		{
+			++NumInFlight;
+			continue;
+		}
+		ShardSearch.bInFlight = false;
+
+		// Some platforms only run one search at a time, the shard stays queued until a running one completes
+		if (NumInFlight > 0)
+		{
+			break;
+		}
+		UE_LOG(LogTemp, Warning, TEXT("Failed to start search shard (Region: %s, World: %s)"), *ShardSearch.Shard.Region, *ShardSearch.Shard.World);
+		ShardSearch.bDone = true;
+	}
+	bIsLaunchingShards = false;
+
+	// Searches that completed inside FindSessions, or shards that could not start at all
+	const bool bCollectedShards = CollectCompletedShards();
+	if (bCollectedShards || NumInFlight == 0)
+	{
+		UpdateShardedSearch();
+	}
+}
+bool UEOSSession::CollectCompletedShards()
+{
+	// The delegate does not tell which search completed, pick the shards whose search reached a final state
+	bool bFoundCompletedShard = false;
+	for (FShardSearch& ShardSearch : ShardSearches)
+	{
+		const EOnlineAsyncTaskState::Type SearchState = ShardSearch.Search->SearchState;
+		if (ShardSearch.bInFlight && (SearchState == EOnlineAsyncTaskState::Done || SearchState == EOnlineAsyncTaskState::Failed))
+		{
+			ShardSearch.bInFlight = false;
+			ShardSearch.bDone = true;
+			ShardSearch.bWasSuccessful = SearchState == EOnlineAsyncTaskState::Done;
+			bFoundCompletedShard = true;
+		}
+	}
+	return bFoundCompletedShard;
+}
+void UEOSSession::OnShardSearchCompleted(bool bWasSuccess)
+{
+	// Completions raised while starting shards are collected by LaunchShardSearches
+	if (bIsLaunchingShards)
+	{
+		return;
+	}
+
+	// The completion belongs to a search that is not ours
+	if (!CollectCompletedShards())
+	{
+		return;
+	}
+	UpdateShardedSearch();
+}
+void UEOSSession::UpdateShardedSearch()
+{
+	// Sort each completed shard once, the merge only walks the heads of these runs
+	int32 CompletedShards = 0;
+	for (FShardSearch& ShardSearch : ShardSearches)
+	{
+		if (!ShardSearch.bDone)
+		{
+			continue;
+		}
+		++CompletedShards;
+
+		if (ShardSearch.bWasSuccessful && ShardSearch.SortedResults.Num() == 0 && ShardSearch.Search->SearchResults.Num() > 0)
+		{
+			ShardSearch.SortedResults.Reserve(ShardSearch.Search->SearchResults.Num());
+			for (const FOnlineSessionSearchResult& SearchResult : ShardSearch.Search->SearchResults)
+			{
+				ShardSearch.SortedResults.Add(FSessionServer(SearchResult));
+			}
+			const ESessionSortKey SortKey = ShardedSearchSettings.SortKey;
+			Algo::Sort(ShardSearch.SortedResults, [SortKey](const FSessionServer& A, const FSessionServer& B) { return EOSSessionShards::IsBefore(A, B, SortKey); });
+		}
+	}
+
+	const TArray<FSessionServer> Merged = MergeShardResults(ShardedSearchSettings.DesiredResults);
+	if (!bHasDeliveredShardedResults && OnShardedSearchProgressDelegate.IsBound())
+	{
+		OnShardedSearchProgressDelegate.Broadcast(Merged, CompletedShards, ShardSearches.Num());
+	}
+	UE_LOG(LogTemp, Log, TEXT("Sharded Search: %d of %d shards completed, %d sessions merged"), CompletedShards, ShardSearches.Num(), Merged.Num());
+
+	if (CompletedShards == ShardSearches.Num())
+	{
+		FinishShardedSearch();
+		return;
+	}
+
+	// Do not wait for the slowest shards once enough results are known, they only update the delta and the cache
+	if (!bHasDeliveredShardedResults && ShardedSearchSettings.DesiredResults > 0 && Merged.Num() >= ShardedSearchSettings.DesiredResults)
+	{
+		DeliverShardedResults();
+	}
+	LaunchShardSearches();
+}
+void UEOSSession::OnShardedSearchDeadline()
+{
+	if (ShardSearches.Num() == 0 || bHasDeliveredShardedResults)
+	{
+		return;
+	}
+
+	// Without any successful shard there is nothing to deliver yet, wait for the running ones
+	if (!ShardSearches.ContainsByPredicate([](const FShardSearch& ShardSearch) { return ShardSearch.bWasSuccessful; }))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Sharded Search: deadline reached before any shard succeeded"));
+		return;
+	}
+	DeliverShardedResults();
+}
+TArray<FSessionServer> UEOSSession::MergeShardResults(int32 Limit) const
+{
+	using EOSSessionShards::FMergeCursor;
+
+	const ESessionSortKey SortKey = ShardedSearchSettings.SortKey;
+	auto CursorLess = [this, SortKey](const FMergeCursor& A, const FMergeCursor& B)
+	{
+		return EOSSessionShards::IsBefore(ShardSearches[A.ShardIndex].SortedResults[A.ResultIndex], ShardSearches[B.ShardIndex].SortedResults[B.ResultIndex], SortKey);
+	};
+
+	int32 TotalResults = 0;
+	TArray<FMergeCursor> Heap;
+	Heap.Reserve(ShardSearches.Num());
+	for (int32 Index = 0; Index < ShardSearches.Num(); ++Index)
+	{
+		if (ShardSearches[Index].SortedResults.Num() > 0)
+		{
+			Heap.HeapPush(FMergeCursor{ Index, 0 }, CursorLess);
+			TotalResults += ShardSearches[Index].SortedResults.Num();
+		}
+	}
+
+	const int32 MaxResults = Limit > 0 ? FMath::Min(Limit, TotalResults) : TotalResults;
+	TArray<FSessionServer> Merged;
+	Merged.Reserve(MaxResults);
+	TSet<FString> SeenIDs;
+	SeenIDs.Reserve(MaxResults);
+
+	while (Heap.Num() > 0 && Merged.Num() < MaxResults)
+	{
+		FMergeCursor Cursor;
+		Heap.HeapPop(Cursor, CursorLess);
+
+		const FSessionServer& Server = ShardSearches[Cursor.ShardIndex].SortedResults[Cursor.ResultIndex];
+		bool bAlreadySeen = false;
+		SeenIDs.Add(Server.ID, &bAlreadySeen);
+		if (!bAlreadySeen)
+		{
+			Merged.Add(Server);
+		}
+
+		if (++Cursor.ResultIndex < ShardSearches[Cursor.ShardIndex].SortedResults.Num())
+		{
+			Heap.HeapPush(Cursor, CursorLess);
+		}
+	}
+	return Merged;
+}
+void UEOSSession::DeliverShardedResults()
+{
+	bHasDeliveredShardedResults = true;
+	EOSStrategyCorePtr->GetTimerManager().ClearTimer(ShardDeadlineTimerHandle);
+	EOSStrategyCorePtr->GetRateLimiter()->ReportSuccess(EBackendOperation::FindSessions);
+
+	const int32 RunningShards = ShardSearches.FilterByPredicate([](const FShardSearch& ShardSearch) { return !ShardSearch.bDone; }).Num();
+	if (RunningShards > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Sharded Search: delivering results with %d shards still running, the ranking is approximate"), RunningShards);
+	}
+	BroadcastSessionServers(MergeShardResults(ShardedSearchSettings.DesiredResults));
+}
+void UEOSSession::FinishShardedSearch()
+{
+	EOSStrategyCorePtr->GetOnlineSession()->ClearOnFindSessionsCompleteDelegate_Handle(ShardedSearchDelegateHandle);
+	EOSStrategyCorePtr->GetTimerManager().ClearTimer(ShardDeadlineTimerHandle);
+
+	bool bAnyShardSucceeded = false;
+	bool bAllShardsSucceeded = true;
+	for (const FShardSearch& ShardSearch : ShardSearches)
+	{
+		bAnyShardSucceeded |= ShardSearch.bWasSuccessful;
+		bAllShardsSucceeded &= ShardSearch.bWasSuccessful;
+	}
+
+	if (!bHasDeliveredShardedResults)
+	{
+		if (!bAnyShardSucceeded)
+		{
+			ShardSearches.Empty();
+			EOSStrategyCorePtr->GetRateLimiter()->ReportFailure(EBackendOperation::FindSessions);
+			HandleFindOnlineSessionsFailure("Failed to find online sessions.");
+			return;
+		}
+		DeliverShardedResults();
+	}
+	bHasDeliveredShardedResults = false;
+
+	// The delta and the on-disk cache track every merged session, only the delivered list is truncated
+	const TArray<FSessionServer> Servers = MergeShardResults(0);
+	ShardSearches.Empty();
+
+	// Sessions of the failed shards are unknown rather than removed, keep the previous list
+	if (!bAllShardsSucceeded)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Sharded Search: some shards failed, the session delta and the cache were not updated"));
+		return;
+	}
+	UpdateKnownSessionServers(Servers);
+}
+
 void UEOSSession::JoinOnlineSession(FSessionServer SessionServer)
 {
 	if (!EOSStrategyCorePtr->HasOnlineSubsystem())
@@ -182,14 +1053,40 @@ void UEOSSession::JoinOnlineSession(FSessionServer SessionServer)
 		HandleJoinOnlineSessionFailure("Player authentication failed. Please log in to your account.");
 		return;
 	}
-	
-	EOSStrategyCorePtr->GetOnlineSession()->OnJoinSessionCompleteDelegates.AddUObject(this, &UEOSSession::OnJoinSessionCompleted);
+	if (!SessionServer.OnlineSessionSearchResult.IsValid())
+	{
+		HandleJoinOnlineSessionFailure("Session is from the cached server list. Refresh the server list before joining.");
+		return;
+	}
+
+	FString RateLimitError;
+	if (!EOSStrategyCorePtr->GetRateLimiter()->TryAcquire(EBackendOperation::JoinSession, ERequestPriority::Interactive, RateLimitError))
+	{
+		HandleJoinOnlineSessionFailure(RateLimitError);
+		return;
+	}
+
+	PendingJoinServer = SessionServer;
+	// Bound once per join, so each completion reaches the rate limiter a single time
+	EOSStrategyCorePtr->GetOnlineSession()->ClearOnJoinSessionCompleteDelegate_Handle(JoinSessionDelegateHandle);
+	JoinSessionDelegateHandle = EOSStrategyCorePtr->GetOnlineSession()->AddOnJoinSessionCompleteDelegate_Handle(
+		FOnJoinSessionCompleteDelegate::CreateUObject(this, &UEOSSession::OnJoinSessionCompleted));
 	EOSStrategyCorePtr->GetOnlineSession()->JoinSession(0, FName(""), SessionServer.OnlineSessionSearchResult);
 }
-void UEOSSession::OnJoinSessionCompleted(FName SessionName, EOnJoinSessionCompleteResult::Type Result) const
+void UEOSSession::OnJoinSessionCompleted(FName SessionName, EOnJoinSessionCompleteResult::Type Result)
 {
-	// TODO: EOSStrategyCorePtr->GetOnlineSession()->ClearOnJoinSessionCompleteDelegates();
+	EOSStrategyCorePtr->GetOnlineSession()->ClearOnJoinSessionCompleteDelegate_Handle(JoinSessionDelegateHandle);
 	// TODO: VERIFICAR OS OUTROS TIPOS DE ERROR
+	// Only errors of the backend itself extend the backoff, a full or missing session is a valid answer
+	if (Result == EOnJoinSessionCompleteResult::UnknownError || Result == EOnJoinSessionCompleteResult::CouldNotRetrieveAddress)
+	{
+		EOSStrategyCorePtr->GetRateLimiter()->ReportFailure(EBackendOperation::JoinSession);
+	}
+	else
+	{
+		EOSStrategyCorePtr->GetRateLimiter()->ReportSuccess(EBackendOperation::JoinSession);
+	}
+
 	if (Result == EOnJoinSessionCompleteResult::Success)
 	{
 		FString ConnectionInfo;
@@ -198,6 +1095,14 @@ void UEOSSession::OnJoinSessionCompleted(FName SessionName, EOnJoinSessionComple
 			return;
 		}
 
+		RecentServers.RemoveAll([this](const FSessionServer& Server) { return Server.ID == PendingJoinServer.ID; });
+		RecentServers.Insert(PendingJoinServer, 0);
+		if (RecentServers.Num() > MaxRecentServers)
+		{
+			RecentServers.SetNum(MaxRecentServers);
+		}
+		SaveServerCache();
+
 		if (APlayerController* PlayerController = UGameplayStatics::GetPlayerController(EOSStrategyCorePtr->GetWorld(), 0)) {
 			UE_LOG(LogTemp, Log, TEXT("Connection Info: %s"), *ConnectionInfo);
 			PlayerController->ClientTravel(ConnectionInfo, ETravelType::TRAVEL_Absolute);
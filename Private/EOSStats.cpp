@@ -0,0 +1,447 @@
+/**
+ * @file EOSStats.cpp
+ *
+ * @brief Author: Marcel Gheorghe Becheanu
+ * @brief Last Updated: October 18, 2026
+ * @brief Github: https://github.com/marcelbecheanu
+ *
+ * This file contains the implementation of the UEOSStats class, which batches stat updates sent to EOS.
+ */
+
+#include "EOSStats.h"
+#include "EOSStrategyCore.h"
+#include "Interfaces/OnlineIdentityInterface.h"
+#include "Interfaces/OnlineStatsInterface.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "TimerManager.h"
+
+namespace EOSStatsJournal
+{
+    // Identifies the stats journal file ('EOSS')
+    static constexpr uint32 Magic = 0x53534F45;
+
+    // Bumped whenever the layout changes, older journals are discarded
+    static constexpr int32 Version = 2;
+}
+
+// Initialize method to set the EOS strategy core, restore the journal and start the flush timers
+void UEOSStats::Initialize(UEOSStrategyCore* EOSStrategyCore)
+{
+    EOSStrategyCorePtr = EOSStrategyCore;
+    checkf(EOSStrategyCorePtr != nullptr, TEXT("Failed to initialize EOSStrategyCore in EOSStats!"));
+
+    LoadJournal();
+
+    SetFlushInterval(FlushIntervalSeconds);
+    SetJournalInterval(JournalIntervalSeconds);
+}
+
+void UEOSStats::Shutdown()
+{
+    FTimerManager& TimerManager = EOSStrategyCorePtr->GetTimerManager();
+    TimerManager.ClearTimer(FlushTimerHandle);
+    TimerManager.ClearTimer(JournalTimerHandle);
+    TimerManager.ClearTimer(RetryTimerHandle);
+    bIsShuttingDown = true;
+
+    // A batch that never reached the backend is simply pending again
+    if (InFlightStats.Num() > 0 && !bIsBatchSent)
+    {
+        AddIncrements(PendingStats, InFlightStats);
+        InFlightStats.Empty();
+        InFlightBatchId.Invalidate();
+    }
+
+    // Match end stats are usually flushed right before quitting, tick the online subsystem until the backend confirms them
+    const double WaitStartTime = FPlatformTime::Seconds();
+    double LastTickTime = WaitStartTime;
+    while (InFlightStats.Num() > 0 && FPlatformTime::Seconds() - WaitStartTime < ShutdownFlushTimeoutSeconds)
+    {
+        FPlatformProcess::Sleep(0.01f);
+        const double Now = FPlatformTime::Seconds();
+        FTSTicker::GetCoreTicker().Tick(static_cast<float>(Now - LastTickTime));
+        LastTickTime = Now;
+    }
+    if (InFlightStats.Num() > 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Stats batch %s with %d stats was not confirmed within %.1f seconds, it is journaled as unconfirmed."), *InFlightBatchId.ToString(), CountStats(InFlightStats), ShutdownFlushTimeoutSeconds);
+    }
+
+    // The final write replaces whatever the thread pool was writing, so it has to land last
+    if (JournalWriteFuture.IsValid())
+    {
+        JournalWriteFuture.Wait();
+    }
+    bIsJournalDirty = false;
+    if (!SaveJournal(SerializeJournal(), GetJournalPath()))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to write stats journal to %s"), *GetJournalPath());
+    }
+}
+
+void UEOSStats::SetFlushInterval(float Seconds)
+{
+    FlushIntervalSeconds = FMath::Max(1.0f, Seconds);
+    EOSStrategyCorePtr->GetTimerManager().SetTimer(FlushTimerHandle, this, &UEOSStats::FlushStats, FlushIntervalSeconds, true);
+}
+
+void UEOSStats::SetJournalInterval(float Seconds)
+{
+    JournalIntervalSeconds = FMath::Max(0.1f, Seconds);
+    EOSStrategyCorePtr->GetTimerManager().SetTimer(JournalTimerHandle, this, &UEOSStats::WriteJournalIfDirty, JournalIntervalSeconds, true);
+}
+
+void UEOSStats::IncrementStat(const FString& StatName, int32 Amount)
+{
+    if (!EOSStrategyCorePtr->HasOnlineIdentity() || !EOSStrategyCorePtr->GetAuthenticator()->IsAuthenticated())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Cannot increment stat %s. Not authenticated."), *StatName);
+        return;
+    }
+
+    const FUniqueNetIdPtr LocalUserId = EOSStrategyCorePtr->GetOnlineIdentity()->GetUniquePlayerId(0);
+    if (LocalUserId.IsValid())
+    {
+        IncrementUserStat(LocalUserId->ToString(), StatName, Amount);
+    }
+}
+
+// Increments are summed in memory so each user and stat costs one entry per batch
+void UEOSStats::IncrementUserStat(const FString& UserID, const FString& StatName, int32 Amount)
+{
+    if (UserID.IsEmpty() || StatName.IsEmpty() || Amount == 0)
+    {
+        return;
+    }
+
+    int32& Pending = PendingStats.FindOrAdd(UserID).FindOrAdd(StatName);
+    Pending = static_cast<int32>(FMath::Clamp<int64>(static_cast<int64>(Pending) + Amount, MIN_int32, MAX_int32));
+    bIsJournalDirty = true;
+}
+
+void UEOSStats::FlushStats()
+{
+    if (PendingStats.Num() == 0 || bIsShuttingDown)
+    {
+        return;
+    }
+
+    // Only one batch in flight, increments made meanwhile go out right after it
+    if (InFlightStats.Num() > 0)
+    {
+        bIsFlushQueued = true;
+        return;
+    }
+    if (!EOSStrategyCorePtr->HasOnlineStats() || !EOSStrategyCorePtr->HasOnlineIdentity())
+    {
+        HandleFlushStatsFailure("Online stats not available.");
+        return;
+    }
+
+    // All pending increments go out in one batch once the connection is back
+    TWeakObjectPtr<UEOSStats> WeakThis(this);
+    if (EOSStrategyCorePtr->GetRequestJournal()->DeferIfOffline(EBackendOperation::UpdateStats, TEXT("FlushStats"), [WeakThis]()
+    {
+        if (UEOSStats* Stats = WeakThis.Get())
+        {
+            Stats->FlushStats();
+        }
+    }))
+    {
+        HandleFlushStatsFailure("Queued while offline, the stats are sent once the connection is restored.");
+        return;
+    }
+
+    // Retry as soon as the budget allows instead of waiting for the next interval
+    FString RateLimitError;
+    if (!EOSStrategyCorePtr->GetRateLimiter()->TryAcquire(EBackendOperation::UpdateStats, ERequestPriority::Background, RateLimitError))
+    {
+        const float RetryDelay = EOSStrategyCorePtr->GetRateLimiter()->GetRetryDelay(EBackendOperation::UpdateStats, ERequestPriority::Background);
+        EOSStrategyCorePtr->GetTimerManager().SetTimer(RetryTimerHandle, this, &UEOSStats::FlushStats, FMath::Max(RetryDelay, 0.1f), false);
+        HandleFlushStatsFailure(RateLimitError);
+        return;
+    }
+
+    InFlightStats = MoveTemp(PendingStats);
+    PendingStats.Reset();
+    InFlightBatchId = FGuid::NewGuid();
+    bIsBatchSent = false;
+
+    // The batch is only sent once the journal records it apart from the pending increments, so it is never summed twice
+    WriteJournal();
+}
+
+void UEOSStats::SendInFlightBatch()
+{
+    const IOnlineIdentityPtr OnlineIdentity = EOSStrategyCorePtr->GetOnlineIdentity();
+    TArray<FOnlineStatsUserUpdatedStats> UpdatedUserStats;
+    UpdatedUserStats.Reserve(InFlightStats.Num());
+    for (const TPair<FString, TMap<FString, int32>>& UserStats : InFlightStats)
+    {
+        const FUniqueNetIdPtr UserId = OnlineIdentity->CreateUniquePlayerId(UserStats.Key);
+        if (!UserId.IsValid())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Dropping stats of invalid user ID %s."), *UserStats.Key);
+            continue;
+        }
+
+        FOnlineStatsUserUpdatedStats& Updated = UpdatedUserStats.Emplace_GetRef(UserId.ToSharedRef());
+        for (const TPair<FString, int32>& Stat : UserStats.Value)
+        {
+            Updated.Stats.Add(Stat.Key, FOnlineStatUpdate(FOnlineStatValue(Stat.Value), FOnlineStatUpdate::EOnlineStatModificationType::Sum));
+        }
+    }
+
+    // Dedicated servers are not logged in, the first user of the batch issues the update
+    FUniqueNetIdPtr LocalUserId = OnlineIdentity->GetUniquePlayerId(0);
+    if (!LocalUserId.IsValid() && UpdatedUserStats.Num() > 0)
+    {
+        LocalUserId = UpdatedUserStats[0].Account;
+    }
+    if (!LocalUserId.IsValid())
+    {
+        InFlightStats.Empty();
+        InFlightBatchId.Invalidate();
+        WriteJournal();
+        HandleFlushStatsFailure("No valid user ID, the batch was dropped.");
+        return;
+    }
+
+    bIsBatchSent = true;
+    FlushStartTime = FPlatformTime::Seconds();
+
+    UE_LOG(LogTemp, Log, TEXT("Flushing batch %s with %d stats for %d users"), *InFlightBatchId.ToString(), CountStats(InFlightStats), UpdatedUserStats.Num());
+    EOSStrategyCorePtr->GetOnlineStats()->UpdateStats(LocalUserId.ToSharedRef(), UpdatedUserStats,
+        FOnlineStatsUpdateStatsComplete::CreateUObject(this, &UEOSStats::OnFlushStatsCompleted));
+}
+
+void UEOSStats::OnFlushStatsCompleted(const FOnlineError& Result)
+{
+    LastFlushLatency = static_cast<float>(FPlatformTime::Seconds() - FlushStartTime);
+    const int32 NumStats = CountStats(InFlightStats);
+
+    if (!Result.WasSuccessful())
+    {
+        EOSStrategyCorePtr->GetRateLimiter()->ReportFailure(EBackendOperation::UpdateStats);
+
+        // The backend rejected the batch, put it back in front of the increments made meanwhile
+        AddIncrements(PendingStats, InFlightStats);
+        InFlightStats.Empty();
+        InFlightBatchId.Invalidate();
+        bIsBatchSent = false;
+        bIsFlushQueued = false;
+        WriteJournal();
+
+        UE_LOG(LogTemp, Error, TEXT("Failed to flush %d stats. Reason: %s"), NumStats, *Result.ToLogString());
+        if (OnStatsFlushedDelegate.IsBound())
+        {
+            OnStatsFlushedDelegate.Broadcast(false, NumStats, LastFlushLatency, Result.ToLogString());
+        }
+        return;
+    }
+    EOSStrategyCorePtr->GetRateLimiter()->ReportSuccess(EBackendOperation::UpdateStats);
+
+    // The batch is confirmed, drop it from the journal
+    InFlightStats.Empty();
+    InFlightBatchId.Invalidate();
+    bIsBatchSent = false;
+    WriteJournal();
+
+    UE_LOG(LogTemp, Log, TEXT("Flushed %d stats in %.3f seconds"), NumStats, LastFlushLatency);
+    if (OnStatsFlushedDelegate.IsBound())
+    {
+        OnStatsFlushedDelegate.Broadcast(true, NumStats, LastFlushLatency, "Success!");
+    }
+
+    if (bIsFlushQueued && !bIsShuttingDown)
+    {
+        bIsFlushQueued = false;
+        FlushStats();
+    }
+}
+
+void UEOSStats::HandleFlushStatsFailure(const FString& ErrorMessage) const
+{
+    const int32 NumStats = CountStats(PendingStats);
+    UE_LOG(LogTemp, Warning, TEXT("Cannot flush %d stats. %s"), NumStats, *ErrorMessage);
+    if (OnStatsFlushedDelegate.IsBound())
+    {
+        OnStatsFlushedDelegate.Broadcast(false, NumStats, 0.0f, ErrorMessage);
+    }
+}
+
+int32 UEOSStats::GetQueueDepth() const
+{
+    return CountStats(PendingStats) + CountStats(InFlightStats);
+}
+
+float UEOSStats::GetLastFlushLatency() const
+{
+    return LastFlushLatency;
+}
+
+void UEOSStats::AddIncrements(FUserStatIncrements& Target, const FUserStatIncrements& Source)
+{
+    for (const TPair<FString, TMap<FString, int32>>& UserStats : Source)
+    {
+        TMap<FString, int32>& TargetStats = Target.FindOrAdd(UserStats.Key);
+        for (const TPair<FString, int32>& Stat : UserStats.Value)
+        {
+            int32& Value = TargetStats.FindOrAdd(Stat.Key);
+            Value = static_cast<int32>(FMath::Clamp<int64>(static_cast<int64>(Value) + Stat.Value, MIN_int32, MAX_int32));
+        }
+    }
+}
+
+int32 UEOSStats::CountStats(const FUserStatIncrements& Increments)
+{
+    int32 NumStats = 0;
+    for (const TPair<FString, TMap<FString, int32>>& UserStats : Increments)
+    {
+        NumStats += UserStats.Value.Num();
+    }
+    return NumStats;
+}
+
+FString UEOSStats::GetJournalPath() const
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EOSStrategy"), TEXT("StatsJournal.bin"));
+}
+
+// Restores the increments that were never sent in a previous run
+void UEOSStats::LoadJournal()
+{
+    TArray<uint8> Data;
+    if (!FFileHelper::LoadFileToArray(Data, *GetJournalPath(), FILEREAD_Silent))
+    {
+        return;
+    }
+
+    FMemoryReader Reader(Data);
+    uint32 FileMagic = 0;
+    int32 FileVersion = 0;
+    FUserStatIncrements Journal;
+    FGuid UnconfirmedBatchId;
+    FUserStatIncrements UnconfirmedBatch;
+    Reader << FileMagic << FileVersion;
+    if (Reader.IsError() || FileMagic != EOSStatsJournal::Magic || FileVersion != EOSStatsJournal::Version)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Discarding stats journal with unknown format."));
+        return;
+    }
+    Reader << Journal << UnconfirmedBatchId << UnconfirmedBatch;
+    if (Reader.IsError())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Discarding corrupted stats journal."));
+        return;
+    }
+
+    // The backend may have summed the batch before the game stopped, sending it again could count it twice.
+    // Every dropped increment is logged so it can be reconciled by hand.
+    if (UnconfirmedBatch.Num() > 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Dropping unconfirmed stats batch %s with %d stats, it may already have been applied."), *UnconfirmedBatchId.ToString(), CountStats(UnconfirmedBatch));
+        for (const TPair<FString, TMap<FString, int32>>& UserStats : UnconfirmedBatch)
+        {
+            for (const TPair<FString, int32>& Stat : UserStats.Value)
+            {
+                UE_LOG(LogTemp, Error, TEXT("Unconfirmed stat %s of user %s: %d"), *Stat.Key, *UserStats.Key, Stat.Value);
+            }
+        }
+    }
+
+    AddIncrements(PendingStats, Journal);
+    UE_LOG(LogTemp, Log, TEXT("Restored %d unflushed stats from the journal."), CountStats(Journal));
+}
+
+// The journal holds the pending increments and, apart from them, the batch in flight with its ID
+TArray<uint8> UEOSStats::SerializeJournal()
+{
+    TArray<uint8> Data;
+    if (PendingStats.Num() == 0 && InFlightStats.Num() == 0)
+    {
+        return Data;
+    }
+
+    FMemoryWriter Writer(Data);
+    uint32 FileMagic = EOSStatsJournal::Magic;
+    int32 FileVersion = EOSStatsJournal::Version;
+    Writer << FileMagic << FileVersion << PendingStats << InFlightBatchId << InFlightStats;
+    return Data;
+}
+
+// Writes a temporary file and swaps it in, so an interrupted write never leaves a torn journal behind
+bool UEOSStats::SaveJournal(const TArray<uint8>& Data, const FString& Path)
+{
+    if (Data.Num() == 0)
+    {
+        return !IFileManager::Get().FileExists(*Path) || IFileManager::Get().Delete(*Path, false, false, true);
+    }
+
+    const FString TempPath = Path + TEXT(".tmp");
+    return FFileHelper::SaveArrayToFile(Data, *TempPath) && IFileManager::Get().Move(*Path, *TempPath, true);
+}
+
+void UEOSStats::WriteJournal()
+{
+    // Only one write runs at a time, changes made meanwhile are written once it completes
+    if (bIsWritingJournal)
+    {
+        bIsJournalDirty = true;
+        return;
+    }
+    bIsWritingJournal = true;
+    bIsJournalDirty = false;
+
+    // Write off the game thread, the buffer is already detached from the stats
+    TWeakObjectPtr<UEOSStats> WeakThis(this);
+    JournalWriteFuture = Async(EAsyncExecution::ThreadPool, [WeakThis, Data = SerializeJournal(), Path = GetJournalPath(), WrittenBatchId = InFlightBatchId]()
+    {
+        if (!SaveJournal(Data, Path))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Failed to write stats journal to %s"), *Path);
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, WrittenBatchId]()
+        {
+            if (UEOSStats* Stats = WeakThis.Get())
+            {
+                Stats->OnJournalWritten(WrittenBatchId);
+            }
+        });
+    });
+}
+
+void UEOSStats::OnJournalWritten(const FGuid& WrittenBatchId)
+{
+    bIsWritingJournal = false;
+    if (bIsShuttingDown)
+    {
+        return;
+    }
+
+    // The batch is on disk, it can go out now
+    if (InFlightStats.Num() > 0 && !bIsBatchSent && WrittenBatchId == InFlightBatchId)
+    {
+        SendInFlightBatch();
+    }
+
+    if (bIsJournalDirty)
+    {
+        WriteJournal();
+    }
+}
+
+void UEOSStats::WriteJournalIfDirty()
+{
+    if (bIsJournalDirty)
+    {
+        WriteJournal();
+    }
+}
@@ -0,0 +1,602 @@
+/**
+ * @file EOSStorage.cpp
+ *
+ * @brief Author: Marcel Gheorghe Becheanu
+ * @brief Last Updated: October 18, 2026
+ * @brief Github: https://github.com/marcelbecheanu
+ *
+ * This file contains the implementation of the UEOSStorage class, which transfers title and player storage files and caches them locally.
+ */
+
+#include "EOSStorage.h"
+#include "EOSStrategyCore.h"
+#include "Interfaces/OnlineIdentityInterface.h"
+#include "Interfaces/OnlineTitleFileInterface.h"
+#include "Interfaces/OnlineUserCloudInterface.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "TimerManager.h"
+
+// Initialize method to set the EOS strategy core and listen to the storage interfaces
+void UEOSStorage::Initialize(UEOSStrategyCore* EOSStrategyCore)
+{
+    EOSStrategyCorePtr = EOSStrategyCore;
+    checkf(EOSStrategyCorePtr != nullptr, TEXT("Failed to initialize EOSStrategyCore in EOSStorage!"));
+
+    // Transfers run concurrently, so the delegates stay bound and are matched against ActiveTransfers
+    if (EOSStrategyCorePtr->HasOnlineTitleFile())
+    {
+        const IOnlineTitleFilePtr OnlineTitleFile = EOSStrategyCorePtr->GetOnlineTitleFile();
+        OnlineTitleFile->AddOnEnumerateFilesCompleteDelegate_Handle(FOnEnumerateFilesCompleteDelegate::CreateUObject(this, &UEOSStorage::OnEnumerateTitleFilesCompleted));
+        OnlineTitleFile->AddOnReadFileProgressDelegate_Handle(FOnReadFileProgressDelegate::CreateUObject(this, &UEOSStorage::OnTitleFileProgress));
+        OnlineTitleFile->AddOnReadFileCompleteDelegate_Handle(FOnReadFileCompleteDelegate::CreateUObject(this, &UEOSStorage::OnTitleFileReadCompleted));
+    }
+    if (EOSStrategyCorePtr->HasOnlineUserCloud())
+    {
+        const IOnlineUserCloudPtr OnlineUserCloud = EOSStrategyCorePtr->GetOnlineUserCloud();
+        OnlineUserCloud->AddOnEnumerateUserFilesCompleteDelegate_Handle(FOnEnumerateUserFilesCompleteDelegate::CreateUObject(this, &UEOSStorage::OnEnumerateUserFilesCompleted));
+        OnlineUserCloud->AddOnReadUserFileCompleteDelegate_Handle(FOnReadUserFileCompleteDelegate::CreateUObject(this, &UEOSStorage::OnUserFileReadCompleted));
+        OnlineUserCloud->AddOnWriteUserFileProgressDelegate_Handle(FOnWriteUserFileProgressDelegate::CreateUObject(this, &UEOSStorage::OnUserFileWriteProgress));
+        OnlineUserCloud->AddOnWriteUserFileCompleteDelegate_Handle(FOnWriteUserFileCompleteDelegate::CreateUObject(this, &UEOSStorage::OnUserFileWriteCompleted));
+    }
+
+    // Entries superseded in previous runs are only found by the size cap
+    TrimCacheAsync();
+}
+
+FString UEOSStorage::MakeTransferKey(EStorageType StorageType, const FString& FileName)
+{
+    return FString::Printf(TEXT("%d|%s"), static_cast<int32>(StorageType), *FileName);
+}
+
+// Hashes the contents the same way the backend does, so local and remote hashes can be compared
+FString UEOSStorage::HashContents(const TArray<uint8>& Contents, FName HashType)
+{
+    if (HashType == FName("MD5"))
+    {
+        return FMD5::HashBytes(Contents.GetData(), Contents.Num());
+    }
+
+    FSHAHash Hash;
+    FSHA1::HashBuffer(Contents.GetData(), Contents.Num(), Hash.Hash);
+    return Hash.ToString();
+}
+
+FString UEOSStorage::GetCacheDirectory() const
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EOSStrategy"), TEXT("StorageCache"));
+}
+
+FString UEOSStorage::GetCachePath(const FString& ContentHash) const
+{
+    return FPaths::Combine(GetCacheDirectory(), ContentHash.ToLower());
+}
+
+// Deletes the least recently used cache entries until the cache fits in MaxCacheSizeBytes
+void UEOSStorage::TrimCacheAsync() const
+{
+    Async(EAsyncExecution::ThreadPool, [Directory = GetCacheDirectory(), MaxBytes = FMath::Max<int64>(0, MaxCacheSizeBytes)]()
+    {
+        struct FCacheEntry
+        {
+            FString Path;
+            int64 Size;
+            FDateTime LastUsed;
+        };
+
+        TArray<FCacheEntry> Entries;
+        int64 TotalBytes = 0;
+        IFileManager::Get().IterateDirectoryStat(*Directory, [&Entries, &TotalBytes](const TCHAR* Path, const FFileStatData& StatData)
+        {
+            if (!StatData.bIsDirectory)
+            {
+                Entries.Add(FCacheEntry{ Path, StatData.FileSize, StatData.ModificationTime });
+                TotalBytes += StatData.FileSize;
+            }
+            return true;
+        });
+        if (TotalBytes <= MaxBytes)
+        {
+            return;
+        }
+
+        Entries.Sort([](const FCacheEntry& A, const FCacheEntry& B) { return A.LastUsed < B.LastUsed; });
+        for (const FCacheEntry& Entry : Entries)
+        {
+            if (TotalBytes <= MaxBytes)
+            {
+                break;
+            }
+            if (IFileManager::Get().Delete(*Entry.Path, false, false, true))
+            {
+                TotalBytes -= Entry.Size;
+            }
+        }
+    });
+}
+
+// Replaces the hash of a file and deletes the cache entry of the old contents unless another file still has them
+void UEOSStorage::SetRemoteHash(FRemoteFileInfo& RemoteFile, const FString& Hash)
+{
+    const FString PreviousHash = RemoteFile.Hash;
+    RemoteFile.Hash = Hash;
+    if (PreviousHash.IsEmpty() || PreviousHash == Hash)
+    {
+        return;
+    }
+
+    for (const TPair<FString, FRemoteFileInfo>& Other : RemoteFiles)
+    {
+        if (Other.Value.Hash == PreviousHash)
+        {
+            return;
+        }
+    }
+    Async(EAsyncExecution::ThreadPool, [Path = GetCachePath(PreviousHash)]()
+    {
+        IFileManager::Get().Delete(*Path, false, false, true);
+    });
+}
+
+// Keeps the latest contents in memory, dropping the least recently stored beyond MaxInMemoryBytes
+void UEOSStorage::StoreFileContents(const FString& TransferKey, TArray<uint8>&& Contents)
+{
+    if (const TArray<uint8>* Previous = FileContents.Find(TransferKey))
+    {
+        FileContentsBytes -= Previous->Num();
+        FileContentsOrder.Remove(TransferKey);
+    }
+    FileContentsBytes += Contents.Num();
+    FileContents.Add(TransferKey, MoveTemp(Contents));
+    FileContentsOrder.Add(TransferKey);
+
+    // The latest file is always kept, so its contents can be fetched right after completion
+    while (FileContentsBytes > MaxInMemoryBytes && FileContentsOrder.Num() > 1)
+    {
+        TArray<uint8> Evicted;
+        if (FileContents.RemoveAndCopyValue(FileContentsOrder[0], Evicted))
+        {
+            FileContentsBytes -= Evicted.Num();
+        }
+        FileContentsOrder.RemoveAt(0);
+    }
+}
+
+FUniqueNetIdPtr UEOSStorage::GetLocalUserId() const
+{
+    if (!EOSStrategyCorePtr->HasOnlineIdentity() || !EOSStrategyCorePtr->GetAuthenticator()->IsAuthenticated())
+    {
+        return nullptr;
+    }
+    return EOSStrategyCorePtr->GetOnlineIdentity()->GetUniquePlayerId(0);
+}
+
+void UEOSStorage::RefreshFileList(EStorageType StorageType)
+{
+    if (StorageType == EStorageType::Title)
+    {
+        if (!EOSStrategyCorePtr->HasOnlineTitleFile() || !EOSStrategyCorePtr->GetOnlineTitleFile()->EnumerateFiles())
+        {
+            OnEnumerateTitleFilesCompleted(false, "Online Title File is not available.");
+        }
+        return;
+    }
+
+    const FUniqueNetIdPtr UserId = GetLocalUserId();
+    if (!EOSStrategyCorePtr->HasOnlineUserCloud() || !UserId.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Cannot enumerate player storage. Online User Cloud not available or not authenticated."));
+        if (OnStorageFileListCompletedDelegate.IsBound())
+        {
+            OnStorageFileListCompletedDelegate.Broadcast(StorageType, TArray<FString>(), false, "Online User Cloud not available or not authenticated.");
+        }
+        return;
+    }
+    EOSStrategyCorePtr->GetOnlineUserCloud()->EnumerateUserFiles(*UserId);
+}
+
+void UEOSStorage::UpdateRemoteFiles(EStorageType StorageType, const TArray<FCloudFileHeader>& Files, TArray<FString>& OutFileNames)
+{
+    // Files missing from the new list can no longer be served from the cache
+    const FString Prefix = MakeTransferKey(StorageType, FString());
+    for (TPair<FString, FRemoteFileInfo>& RemoteFile : RemoteFiles)
+    {
+        if (RemoteFile.Key.StartsWith(Prefix))
+        {
+            RemoteFile.Value.bIsConfirmed = false;
+        }
+    }
+
+    OutFileNames.Reserve(Files.Num());
+    for (const FCloudFileHeader& File : Files)
+    {
+        FRemoteFileInfo& RemoteFile = RemoteFiles.FindOrAdd(MakeTransferKey(StorageType, File.FileName));
+        SetRemoteHash(RemoteFile, File.Hash);
+        RemoteFile.HashType = File.HashType;
+        RemoteFile.Size = File.FileSize;
+        RemoteFile.bIsConfirmed = !File.Hash.IsEmpty();
+        OutFileNames.Add(File.FileName);
+    }
+}
+
+void UEOSStorage::OnEnumerateTitleFilesCompleted(bool bWasSuccessful, const FString& Error)
+{
+    TArray<FString> FileNames;
+    if (bWasSuccessful)
+    {
+        TArray<FCloudFileHeader> Files;
+        EOSStrategyCorePtr->GetOnlineTitleFile()->GetFileList(Files);
+        UpdateRemoteFiles(EStorageType::Title, Files, FileNames);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to enumerate title storage. Reason: %s"), *Error);
+    }
+
+    if (OnStorageFileListCompletedDelegate.IsBound())
+    {
+        OnStorageFileListCompletedDelegate.Broadcast(EStorageType::Title, FileNames, bWasSuccessful, bWasSuccessful ? FString("Success!") : Error);
+    }
+}
+
+void UEOSStorage::OnEnumerateUserFilesCompleted(bool bWasSuccessful, const FUniqueNetId& UserId)
+{
+    TArray<FString> FileNames;
+    if (bWasSuccessful)
+    {
+        TArray<FCloudFileHeader> Files;
+        EOSStrategyCorePtr->GetOnlineUserCloud()->GetUserFileList(UserId, Files);
+        UpdateRemoteFiles(EStorageType::Player, Files, FileNames);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to enumerate player storage."));
+    }
+
+    if (OnStorageFileListCompletedDelegate.IsBound())
+    {
+        OnStorageFileListCompletedDelegate.Broadcast(EStorageType::Player, FileNames, bWasSuccessful, bWasSuccessful ? FString("Success!") : FString("Failed to enumerate player storage."));
+    }
+}
+
+// Files whose confirmed remote hash is already in the cache are read from disk, everything else is queued for download
+void UEOSStorage::ReadStorageFile(EStorageType StorageType, const FString& FileName)
+{
+    const FString TransferKey = MakeTransferKey(StorageType, FileName);
+    const FRemoteFileInfo* RemoteFile = RemoteFiles.Find(TransferKey);
+    if (RemoteFile != nullptr && RemoteFile->bIsConfirmed && IFileManager::Get().FileSize(*GetCachePath(RemoteFile->Hash)) == RemoteFile->Size)
+    {
+        ServeFromCache(StorageType, FileName, *RemoteFile);
+        return;
+    }
+
+    FStorageTransfer Transfer;
+    Transfer.StorageType = StorageType;
+    Transfer.FileName = FileName;
+    Transfer.TotalBytes = RemoteFile != nullptr ? RemoteFile->Size : 0;
+    EnqueueTransfer(MoveTemp(Transfer));
+}
+
+void UEOSStorage::ServeFromCache(EStorageType StorageType, const FString& FileName, const FRemoteFileInfo& RemoteFile)
+{
+    TWeakObjectPtr<UEOSStorage> WeakThis(this);
+    Async(EAsyncExecution::ThreadPool, [WeakThis, StorageType, FileName, RemoteFile, Path = GetCachePath(RemoteFile.Hash)]()
+    {
+        // Verify the contents, a corrupted cache entry falls back to a download
+        TArray<uint8> Contents;
+        const bool bIsValid = FFileHelper::LoadFileToArray(Contents, *Path, FILEREAD_Silent) && HashContents(Contents, RemoteFile.HashType) == RemoteFile.Hash;
+        if (bIsValid)
+        {
+            // The size cap evicts the least recently used entries first
+            IFileManager::Get().SetTimeStamp(*Path, FDateTime::UtcNow());
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, StorageType, FileName, bIsValid, Contents = MoveTemp(Contents)]() mutable
+        {
+            UEOSStorage* Storage = WeakThis.Get();
+            if (Storage == nullptr)
+            {
+                return;
+            }
+
+            if (!bIsValid)
+            {
+                FStorageTransfer Transfer;
+                Transfer.StorageType = StorageType;
+                Transfer.FileName = FileName;
+                Storage->EnqueueTransfer(MoveTemp(Transfer));
+                return;
+            }
+
+            ++Storage->Metrics.CacheHits;
+            Storage->Metrics.BytesFromCache += Contents.Num();
+            Storage->CompleteRead(StorageType, FileName, MoveTemp(Contents), true);
+        });
+    });
+}
+
+// Streams the contents in chunks before reporting completion
+void UEOSStorage::CompleteRead(EStorageType StorageType, const FString& FileName, TArray<uint8>&& Contents, bool bFromCache)
+{
+    const int64 TotalBytes = Contents.Num();
+    if (OnStorageFileChunkDelegate.IsBound())
+    {
+        const int32 StreamChunkSize = FMath::Max(1, ChunkSize);
+        TArray<uint8> Chunk;
+        for (int32 Offset = 0; Offset < Contents.Num(); Offset += StreamChunkSize)
+        {
+            Chunk.Reset();
+            Chunk.Append(Contents.GetData() + Offset, FMath::Min(StreamChunkSize, Contents.Num() - Offset));
+            OnStorageFileChunkDelegate.Broadcast(StorageType, FileName, Chunk, Offset, TotalBytes);
+        }
+    }
+
+    StoreFileContents(MakeTransferKey(StorageType, FileName), MoveTemp(Contents));
+    if (OnStorageFileCompletedDelegate.IsBound())
+    {
+        OnStorageFileCompletedDelegate.Broadcast(StorageType, FileName, true, bFromCache, "Success!");
+    }
+}
+
+// Writes with contents the backend already has are skipped entirely
+void UEOSStorage::WritePlayerStorageFile(const FString& FileName, const TArray<uint8>& Contents)
+{
+    const FString TransferKey = MakeTransferKey(EStorageType::Player, FileName);
+    const FRemoteFileInfo* RemoteFile = RemoteFiles.Find(TransferKey);
+    const FName HashType = RemoteFile != nullptr && !RemoteFile->HashType.IsNone() ? RemoteFile->HashType : FName("SHA1");
+    const FString ContentHash = HashContents(Contents, HashType);
+
+    if (RemoteFile != nullptr && RemoteFile->bIsConfirmed && RemoteFile->Hash == ContentHash && RemoteFile->Size == Contents.Num())
+    {
+        ++Metrics.CacheHits;
+        Metrics.BytesFromCache += Contents.Num();
+        StoreFileContents(TransferKey, TArray<uint8>(Contents));
+        if (OnStorageFileCompletedDelegate.IsBound())
+        {
+            OnStorageFileCompletedDelegate.Broadcast(EStorageType::Player, FileName, true, true, "Success!");
+        }
+        return;
+    }
+
+    FStorageTransfer Transfer;
+    Transfer.StorageType = EStorageType::Player;
+    Transfer.FileName = FileName;
+    Transfer.bIsWrite = true;
+    Transfer.Contents = Contents;
+    Transfer.ContentHash = ContentHash;
+    Transfer.TotalBytes = Contents.Num();
+    EnqueueTransfer(MoveTemp(Transfer));
+}
+
+bool UEOSStorage::GetStorageFileContents(EStorageType StorageType, const FString& FileName, TArray<uint8>& OutContents) const
+{
+    const TArray<uint8>* Contents = FileContents.Find(MakeTransferKey(StorageType, FileName));
+    if (Contents == nullptr)
+    {
+        return false;
+    }
+
+    OutContents = *Contents;
+    return true;
+}
+
+FStorageMetrics UEOSStorage::GetStorageMetrics() const
+{
+    return Metrics;
+}
+
+// Identical reads are coalesced, a newer write replaces a queued one
+void UEOSStorage::EnqueueTransfer(FStorageTransfer&& Transfer)
+{
+    const FString TransferKey = MakeTransferKey(Transfer.StorageType, Transfer.FileName);
+    if (!Transfer.bIsWrite && ActiveTransfers.Contains(TransferKey))
+    {
+        return;
+    }
+
+    FStorageTransfer* Queued = QueuedTransfers.FindByPredicate([&TransferKey](const FStorageTransfer& Other) { return MakeTransferKey(Other.StorageType, Other.FileName) == TransferKey; });
+    if (Queued != nullptr)
+    {
+        if (Transfer.bIsWrite)
+        {
+            *Queued = MoveTemp(Transfer);
+        }
+        return;
+    }
+
+    QueuedTransfers.Add(MoveTemp(Transfer));
+    ProcessTransferQueue();
+}
+
+void UEOSStorage::ProcessTransferQueue()
+{
+    int32 Index = 0;
+    while (Index < QueuedTransfers.Num() && ActiveTransfers.Num() < FMath::Max(1, MaxConcurrentTransfers))
+    {
+        const FString TransferKey = MakeTransferKey(QueuedTransfers[Index].StorageType, QueuedTransfers[Index].FileName);
+
+        // Only one transfer per file at a time
+        if (ActiveTransfers.Contains(TransferKey))
+        {
+            ++Index;
+            continue;
+        }
+
+        // Wait for the rate limiter instead of failing, the queue is retried once tokens are available
+        const EBackendOperation Operation = QueuedTransfers[Index].bIsWrite ? EBackendOperation::WriteStorage : EBackendOperation::ReadStorage;
+        const float RetryDelay = EOSStrategyCorePtr->GetRateLimiter()->GetRetryDelay(Operation, ERequestPriority::Interactive);
+        if (RetryDelay > 0.0f)
+        {
+            EOSStrategyCorePtr->GetTimerManager().SetTimer(RetryTimerHandle, this, &UEOSStorage::ProcessTransferQueue, RetryDelay, false);
+            return;
+        }
+
+        FString RateLimitError;
+        EOSStrategyCorePtr->GetRateLimiter()->TryAcquire(Operation, ERequestPriority::Interactive, RateLimitError);
+
+        FStorageTransfer& Transfer = ActiveTransfers.Add(TransferKey, MoveTemp(QueuedTransfers[Index]));
+        QueuedTransfers.RemoveAt(Index);
+
+        Transfer.StartTime = FPlatformTime::Seconds();
+        if (!StartTransfer(Transfer))
+        {
+            const EStorageType StorageType = Transfer.StorageType;
+            const FString FileName = Transfer.FileName;
+            ActiveTransfers.Remove(TransferKey);
+            HandleStorageFailure(StorageType, FileName, "Failed to start storage transfer.");
+        }
+    }
+}
+
+bool UEOSStorage::StartTransfer(FStorageTransfer& Transfer)
+{
+    if (Transfer.StorageType == EStorageType::Title)
+    {
+        return EOSStrategyCorePtr->HasOnlineTitleFile() && EOSStrategyCorePtr->GetOnlineTitleFile()->ReadFile(Transfer.FileName);
+    }
+
+    const FUniqueNetIdPtr UserId = GetLocalUserId();
+    if (!EOSStrategyCorePtr->HasOnlineUserCloud() || !UserId.IsValid())
+    {
+        return false;
+    }
+
+    if (Transfer.bIsWrite)
+    {
+        return EOSStrategyCorePtr->GetOnlineUserCloud()->WriteUserFile(*UserId, Transfer.FileName, Transfer.Contents);
+    }
+    return EOSStrategyCorePtr->GetOnlineUserCloud()->ReadUserFile(*UserId, Transfer.FileName);
+}
+
+void UEOSStorage::FinishTransfer(const FString& TransferKey, bool bWasSuccessful)
+{
+    FStorageTransfer Transfer;
+    if (!ActiveTransfers.RemoveAndCopyValue(TransferKey, Transfer))
+    {
+        return;
+    }
+
+    const EBackendOperation Operation = Transfer.bIsWrite ? EBackendOperation::WriteStorage : EBackendOperation::ReadStorage;
+    if (!bWasSuccessful)
+    {
+        EOSStrategyCorePtr->GetRateLimiter()->ReportFailure(Operation);
+        HandleStorageFailure(Transfer.StorageType, Transfer.FileName, Transfer.bIsWrite ? "Failed to write storage file." : "Failed to read storage file.");
+        ProcessTransferQueue();
+        return;
+    }
+    EOSStrategyCorePtr->GetRateLimiter()->ReportSuccess(Operation);
+
+    TArray<uint8> Contents;
+    if (Transfer.bIsWrite)
+    {
+        Contents = MoveTemp(Transfer.Contents);
+        Metrics.BytesUploaded += Contents.Num();
+    }
+    else
+    {
+        // Take the contents out of the online subsystem so they are not kept twice in memory
+        if (Transfer.StorageType == EStorageType::Title)
+        {
+            EOSStrategyCorePtr->GetOnlineTitleFile()->GetFileContents(Transfer.FileName, Contents);
+            EOSStrategyCorePtr->GetOnlineTitleFile()->ClearFile(Transfer.FileName);
+        }
+        else if (const FUniqueNetIdPtr UserId = GetLocalUserId())
+        {
+            EOSStrategyCorePtr->GetOnlineUserCloud()->GetFileContents(*UserId, Transfer.FileName, Contents);
+            EOSStrategyCorePtr->GetOnlineUserCloud()->ClearFile(*UserId, Transfer.FileName);
+        }
+        Metrics.BytesDownloaded += Contents.Num();
+    }
+
+    ++Metrics.CacheMisses;
+    TransferSeconds += FPlatformTime::Seconds() - Transfer.StartTime;
+    if (TransferSeconds > 0.0)
+    {
+        Metrics.ThroughputBytesPerSecond = static_cast<float>((Metrics.BytesDownloaded + Metrics.BytesUploaded) / TransferSeconds);
+    }
+
+    // Remember the contents under their hash. A confirmed write tells what the backend holds, a read of a file
+    // missing from the file list does not, so it is only served from the cache once a file list reports the same hash
+    FRemoteFileInfo& RemoteFile = RemoteFiles.FindOrAdd(TransferKey);
+    if (Transfer.bIsWrite)
+    {
+        RemoteFile.HashType = RemoteFile.HashType.IsNone() ? FName("SHA1") : RemoteFile.HashType;
+        SetRemoteHash(RemoteFile, Transfer.ContentHash);
+        RemoteFile.bIsConfirmed = true;
+    }
+    else if (!RemoteFile.bIsConfirmed)
+    {
+        RemoteFile.HashType = RemoteFile.HashType.IsNone() ? FName("SHA1") : RemoteFile.HashType;
+        SetRemoteHash(RemoteFile, HashContents(Contents, RemoteFile.HashType));
+    }
+    RemoteFile.Size = Contents.Num();
+
+    Async(EAsyncExecution::ThreadPool, [Data = Contents, Path = GetCachePath(RemoteFile.Hash)]()
+    {
+        if (!FFileHelper::SaveArrayToFile(Data, *Path))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Failed to write storage cache entry %s"), *Path);
+        }
+    });
+    TrimCacheAsync();
+
+    if (Transfer.bIsWrite)
+    {
+        StoreFileContents(TransferKey, MoveTemp(Contents));
+        if (OnStorageFileCompletedDelegate.IsBound())
+        {
+            OnStorageFileCompletedDelegate.Broadcast(Transfer.StorageType, Transfer.FileName, true, false, "Success!");
+        }
+    }
+    else
+    {
+        CompleteRead(Transfer.StorageType, Transfer.FileName, MoveTemp(Contents), false);
+    }
+
+    ProcessTransferQueue();
+}
+
+void UEOSStorage::HandleStorageFailure(EStorageType StorageType, const FString& FileName, const FString& ErrorMessage) const
+{
+    UE_LOG(LogTemp, Error, TEXT("%s (%s)"), *ErrorMessage, *FileName);
+    if (OnStorageFileCompletedDelegate.IsBound())
+    {
+        OnStorageFileCompletedDelegate.Broadcast(StorageType, FileName, false, false, ErrorMessage);
+    }
+}
+
+void UEOSStorage::OnTitleFileProgress(const FString& FileName, uint64 NumBytes)
+{
+    const FStorageTransfer* Transfer = ActiveTransfers.Find(MakeTransferKey(EStorageType::Title, FileName));
+    if (Transfer != nullptr && OnStorageFileProgressDelegate.IsBound())
+    {
+        OnStorageFileProgressDelegate.Broadcast(EStorageType::Title, FileName, static_cast<int64>(NumBytes), Transfer->TotalBytes);
+    }
+}
+
+void UEOSStorage::OnTitleFileReadCompleted(bool bWasSuccessful, const FString& FileName)
+{
+    FinishTransfer(MakeTransferKey(EStorageType::Title, FileName), bWasSuccessful);
+}
+
+void UEOSStorage::OnUserFileReadCompleted(bool bWasSuccessful, const FUniqueNetId& UserId, const FString& FileName)
+{
+    FinishTransfer(MakeTransferKey(EStorageType::Player, FileName), bWasSuccessful);
+}
+
+void UEOSStorage::OnUserFileWriteProgress(int32 BytesWritten, const FUniqueNetId& UserId, const FString& FileName)
+{
+    const FStorageTransfer* Transfer = ActiveTransfers.Find(MakeTransferKey(EStorageType::Player, FileName));
+    if (Transfer != nullptr && OnStorageFileProgressDelegate.IsBound())
+    {
+        OnStorageFileProgressDelegate.Broadcast(EStorageType::Player, FileName, BytesWritten, Transfer->TotalBytes);
+    }
+}
+
+void UEOSStorage::OnUserFileWriteCompleted(bool bWasSuccessful, const FUniqueNetId& UserId, const FString& FileName)
+{
+    FinishTransfer(MakeTransferKey(EStorageType::Player, FileName), bWasSuccessful);
+}
@@ -27,6 +27,36 @@ UEOSProfile* UEOSStrategyCore::GetProfile()
 	return Profile;
 }
 
+UEOSFriends* UEOSStrategyCore::GetFriends()
+{
+	return Friends;
+}
+
+UEOSStats* UEOSStrategyCore::GetStats()
+{
+	return Stats;
+}
+
+UEOSLeaderboards* UEOSStrategyCore::GetLeaderboards()
+{
+	return Leaderboards;
+}
+
+UEOSStorage* UEOSStrategyCore::GetStorage()
+{
+	return Storage;
+}
+
+UEOSRateLimiter* UEOSStrategyCore::GetRateLimiter()
+{
+	return RateLimiter;
+}
+
+UEOSRequestJournal* UEOSStrategyCore::GetRequestJournal()
+{
+	return RequestJournal;
+}
+
 // This function initializes the EOS subsystem and obtains the EOS identity interface.
 void UEOSStrategyCore::Init()
 {
@@ -44,6 +74,46 @@ void UEOSStrategyCore::Init()
 	OnlineSession = OnlineSubsystem->GetSessionInterface();
 	checkf(OnlineSession != nullptr, TEXT("Failed to obtain OnlineSessionInterface!"));
 
+	// Obtain the EOS Friends and Presence interfaces, optional on platforms without a social graph
+	OnlineFriends = OnlineSubsystem->GetFriendsInterface();
+	if (OnlineFriends == nullptr)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("OnlineFriendsInterface not available, friends features are disabled."));
+	}
+	OnlinePresence = OnlineSubsystem->GetPresenceInterface();
+
+	// Obtain the EOS Stats interface, stats are kept in the journal while it is not available
+	OnlineStats = OnlineSubsystem->GetStatsInterface();
+	if (OnlineStats == nullptr)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("OnlineStatsInterface not available, stats will not be flushed."));
+	}
+
+	// Obtain the EOS Leaderboards interface
+	OnlineLeaderboards = OnlineSubsystem->GetLeaderboardsInterface();
+	if (OnlineLeaderboards == nullptr)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("OnlineLeaderboardsInterface not available, leaderboard queries are disabled."));
+	}
+
+	// Obtain the EOS Title File and User Cloud interfaces
+	OnlineTitleFile = OnlineSubsystem->GetTitleFileInterface();
+	OnlineUserCloud = OnlineSubsystem->GetUserCloudInterface();
+	if (OnlineTitleFile == nullptr || OnlineUserCloud == nullptr)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("OnlineTitleFileInterface or OnlineUserCloudInterface not available, storage is partially disabled."));
+	}
+
+	// Obtain the EOS Rate Limiter, used by every handler below
+	RateLimiter = NewObject<UEOSRateLimiter>();
+	checkf(RateLimiter != nullptr, TEXT("Failed to initialize EOSRateLimiter!"));
+	RateLimiter->Initialize(this);
+
+	// Obtain the EOS Request Journal, used by every handler below
+	RequestJournal = NewObject<UEOSRequestJournal>();
+	checkf(RequestJournal != nullptr, TEXT("Failed to initialize EOSRequestJournal!"));
+	RequestJournal->Initialize(this);
+
 	// Obtain the EOS Authenticator Handler
 	Authenticator = NewObject<UEOSAuthenticator>();
 	checkf(Authenticator != nullptr, TEXT("Failed to initialize EOSAuthenticator Handler!"));
@@ -53,11 +123,46 @@ void UEOSStrategyCore::Init()
 	Session = NewObject<UEOSSession>();
 	checkf(Session != nullptr, TEXT("Failed to initialize EOSSession Handler!"));
 	Session->Initialize(this);
+	for (const UEOSSessionPresetAsset* PresetAsset : SessionPresetAssets)
+	{
+		Session->RegisterSessionPresets(PresetAsset);
+	}
 
 	// Obtain the EOS Profile Handler
 	Profile = NewObject<UEOSProfile>();
 	checkf(Profile != nullptr, TEXT("Failed to initialize EOSProfile Handler!"));
 	Profile->Initialize(this);
+
+	// Obtain the EOS Friends Handler
+	Friends = NewObject<UEOSFriends>();
+	checkf(Friends != nullptr, TEXT("Failed to initialize EOSFriends Handler!"));
+	Friends->Initialize(this);
+
+	// Obtain the EOS Stats Handler
+	Stats = NewObject<UEOSStats>();
+	checkf(Stats != nullptr, TEXT("Failed to initialize EOSStats Handler!"));
+	Stats->Initialize(this);
+
+	// Obtain the EOS Leaderboards Handler
+	Leaderboards = NewObject<UEOSLeaderboards>();
+	checkf(Leaderboards != nullptr, TEXT("Failed to initialize EOSLeaderboards Handler!"));
+	Leaderboards->Initialize(this);
+
+	// Obtain the EOS Storage Handler
+	Storage = NewObject<UEOSStorage>();
+	checkf(Storage != nullptr, TEXT("Failed to initialize EOSStorage Handler!"));
+	Storage->Initialize(this);
+}
+
+// This function persists the handlers' state before the game instance goes away.
+void UEOSStrategyCore::Shutdown()
+{
+	if (Stats != nullptr)
+	{
+		Stats->Shutdown();
+	}
+
+	Super::Shutdown();
 }
 
 
@@ -96,3 +201,75 @@ IOnlineSessionPtr UEOSStrategyCore::GetOnlineSession() const
 {
 	return OnlineSession;
 }
+
+// Checks if the EOS friends interface is available.
+bool UEOSStrategyCore::HasOnlineFriends() const
+{
+	return OnlineFriends != nullptr;
+}
+
+// Retrieves the EOS friends interface.
+IOnlineFriendsPtr UEOSStrategyCore::GetOnlineFriends() const
+{
+	return OnlineFriends;
+}
+
+// Checks if the EOS presence interface is available.
+bool UEOSStrategyCore::HasOnlinePresence() const
+{
+	return OnlinePresence != nullptr;
+}
+
+// Retrieves the EOS presence interface.
+IOnlinePresencePtr UEOSStrategyCore::GetOnlinePresence() const
+{
+	return OnlinePresence;
+}
+
+// Checks if the EOS stats interface is available.
+bool UEOSStrategyCore::HasOnlineStats() const
+{
+	return OnlineStats != nullptr;
+}
+
+// Retrieves the EOS stats interface.
+IOnlineStatsPtr UEOSStrategyCore::GetOnlineStats() const
+{
+	return OnlineStats;
+}
+
+// Checks if the EOS leaderboards interface is available.
+bool UEOSStrategyCore::HasOnlineLeaderboards() const
+{
+	return OnlineLeaderboards != nullptr;
+}
+
+// Retrieves the EOS leaderboards interface.
+IOnlineLeaderboardsPtr UEOSStrategyCore::GetOnlineLeaderboards() const
+{
+	return OnlineLeaderboards;
+}
+
+// Checks if the EOS title file interface is available.
+bool UEOSStrategyCore::HasOnlineTitleFile() const
+{
+	return OnlineTitleFile != nullptr;
+}
+
+// Retrieves the EOS title file interface.
+IOnlineTitleFilePtr UEOSStrategyCore::GetOnlineTitleFile() const
+{
+	return OnlineTitleFile;
+}
+
+// Checks if the EOS user cloud interface is available.
+bool UEOSStrategyCore::HasOnlineUserCloud() const
+{
+	return OnlineUserCloud != nullptr;
+}
+
+// Retrieves the EOS user cloud interface.
+IOnlineUserCloudPtr UEOSStrategyCore::GetOnlineUserCloud() const
+{
+	return OnlineUserCloud;
+}
@@ -0,0 +1,157 @@
+/**
+ * @file EOSFriends.h
+ * 
+ * @brief Author: Marcel Gheorghe Becheanu
+ * @brief Last Updated: October 18, 2026
+ * @brief Github: https://github.com/marcelbecheanu
+ * 
+ * This file contains the declaration of the UEOSFriends class, which keeps the friends list and presence in sync and joins friends' sessions.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "EOSSession.h"
+#include "EOSFriends.generated.h"
+
+class UEOSStrategyCore;
+class FOnlineFriend;
+class FOnlineUserPresence;
+
+USTRUCT(BlueprintType)
+struct FFriendInfo
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(BlueprintReadWrite, Category = "Friend")
+    FString UserID;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Friend")
+    FString DisplayName;
+
+    /** Presence status text set by the friend's game. */
+    UPROPERTY(BlueprintReadWrite, Category = "Friend")
+    FString Status;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Friend")
+    bool bIsOnline = false;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Friend")
+    bool bIsPlayingThisGame = false;
+
+    /** Whether the friend's session accepts joins via presence. */
+    UPROPERTY(BlueprintReadWrite, Category = "Friend")
+    bool bIsJoinable = false;
+
+    /** The session the friend is in according to presence, empty if none. */
+    UPROPERTY(BlueprintReadWrite, Category = "Friend")
+    FString SessionID;
+
+    /**
+     * @brief Hashes the attributes shown to the player, used to only report friends that changed.
+     *
+     * @return The fingerprint of this friend.
+     */
+    uint32 ComputeFingerprint() const
+    {
+        uint32 Hash = GetTypeHash(DisplayName);
+        Hash = HashCombine(Hash, GetTypeHash(Status));
+        Hash = HashCombine(Hash, GetTypeHash(bIsOnline));
+        Hash = HashCombine(Hash, GetTypeHash(bIsPlayingThisGame));
+        Hash = HashCombine(Hash, GetTypeHash(bIsJoinable));
+        Hash = HashCombine(Hash, GetTypeHash(SessionID));
+        return Hash;
+    }
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnFriendsListUpdatedDelegate, const TArray<FFriendInfo>&, Changed, const TArray<FString>&, Removed);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnFindFriendSessionCompletedDelegate, const FSessionServer&, SessionServer, bool, bWasSuccessful, FString, Error);
+
+/**
+ * @brief Caches the friends list, keeps it in sync with presence updates and finds friends' sessions directly.
+ */
+UCLASS()
+class EOSSTRATEGY_API UEOSFriends : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Initializes the friends handler with the EOS strategy core.
+     *
+     * @param EOSStrategyCore The EOS strategy core
+     */
+    void Initialize(UEOSStrategyCore* EOSStrategyCore);
+
+    /**
+     * @brief Event dispatcher with the friends added or changed and the friends removed since the last update.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "EOS|Friends|Event")
+    FOnFriendsListUpdatedDelegate OnFriendsListUpdatedDelegate;
+
+    /**
+     * @brief Event dispatcher for Find Friend Session completion.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "EOS|Friends|Event")
+    FOnFindFriendSessionCompletedDelegate OnFindFriendSessionCompletedDelegate;
+
+    /**
+     * @brief Reads the friends list from the backend. Afterwards the list is kept in sync through friends and presence events.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|Friends|Action")
+    void RefreshFriendsList();
+
+    UFUNCTION(BlueprintCallable, Category = "EOS|Friends|Query")
+    TArray<FFriendInfo> GetFriends() const;
+
+    UFUNCTION(BlueprintCallable, Category = "EOS|Friends|Query")
+    bool GetFriend(const FString& UserID, FFriendInfo& OutFriend) const;
+
+    /**
+     * @brief Finds the session a friend is in with a single targeted query.
+     *
+     * @param UserID The friend's user ID.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|Friends|Query")
+    void FindFriendSession(const FString& UserID);
+
+    /**
+     * @brief Finds the session a friend is in and joins it.
+     *
+     * @param UserID The friend's user ID.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|Friends|Action")
+    void JoinFriend(const FString& UserID);
+
+private:
+    // Pointer to the EOS strategy core
+    UEOSStrategyCore* EOSStrategyCorePtr;
+
+    // Cached friends keyed by user ID
+    TMap<FString, FFriendInfo> Friends;
+
+    // Net IDs of the cached friends, needed for targeted queries
+    TMap<FString, FUniqueNetIdRef> FriendNetIds;
+
+    // Whether the friends list has been read once and events should be tracked
+    bool bIsFriendsListSynced = false;
+
+    // Whether the pending friend session search should join the session it finds
+    bool bJoinFoundFriendSession = false;
+
+    FDelegateHandle FriendsChangeDelegateHandle;
+    FDelegateHandle PresenceReceivedDelegateHandle;
+    FDelegateHandle FindFriendSessionDelegateHandle;
+
+    static FFriendInfo MakeFriendInfo(const FOnlineFriend& Friend);
+    static void ApplyPresence(FFriendInfo& FriendInfo, const FOnlineUserPresence& Presence);
+
+    void OnReadFriendsListCompleted(int32 LocalUserNum, bool bWasSuccessful, const FString& ListName, const FString& Error);
+    void OnFriendsChanged();
+    void OnPresenceReceived(const FUniqueNetId& UserId, const TSharedRef<FOnlineUserPresence>& Presence);
+
+    void OnFindFriendSessionCompleted(int32 LocalUserNum, bool bWasSuccessful, const TArray<FOnlineSessionSearchResult>& SearchResults);
+    void HandleFindFriendSessionFailure(const FString& ErrorMessage);
+};
@@ -0,0 +1,199 @@
+/**
+ * @file EOSLeaderboards.h
+ * 
+ * @brief Author: Marcel Gheorghe Becheanu
+ * @brief Last Updated: October 18, 2026
+ * @brief Github: https://github.com/marcelbecheanu
+ * 
+ * This file contains the declaration of the UEOSLeaderboards class, which queries and caches leaderboard pages from EOS.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "EOSLeaderboards.generated.h"
+
+class UEOSStrategyCore;
+class FOnlineLeaderboardRead;
+
+UENUM(BlueprintType)
+enum class ELeaderboardQueryType : uint8
+{
+    /** A page of consecutive ranks. */
+    Range,
+
+    /** The ranks around the local player. */
+    AroundMe,
+
+    /** The local player's friends. */
+    Friends
+};
+
+USTRUCT(BlueprintType)
+struct FLeaderboardEntry
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(BlueprintReadWrite, Category = "Leaderboard")
+    int32 Rank = 0;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Leaderboard")
+    FString UserID;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Leaderboard")
+    FString Nickname;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Leaderboard")
+    int32 Score = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FLeaderboardPage
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(BlueprintReadWrite, Category = "Leaderboard")
+    FString LeaderboardName;
+
+    /** The stat the leaderboard is sorted by. */
+    UPROPERTY(BlueprintReadWrite, Category = "Leaderboard")
+    FString StatName;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Leaderboard")
+    ELeaderboardQueryType QueryType = ELeaderboardQueryType::Range;
+
+    /** The page index for range queries, 0 otherwise. */
+    UPROPERTY(BlueprintReadWrite, Category = "Leaderboard")
+    int32 PageIndex = 0;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Leaderboard")
+    TArray<FLeaderboardEntry> Entries;
+
+    /** Whether the entries were served from the cache without querying the backend. */
+    UPROPERTY(BlueprintReadWrite, Category = "Leaderboard")
+    bool bFromCache = false;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnLeaderboardQueryCompletedDelegate, const FLeaderboardPage&, Page, bool, bWasSuccessful, FString, Error);
+
+/**
+ * @brief Serves leaderboard pages from a cache with TTL, prefetching adjacent pages and coalescing identical requests.
+ */
+UCLASS()
+class EOSSTRATEGY_API UEOSLeaderboards : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Initializes the leaderboards handler with the EOS strategy core.
+     *
+     * @param EOSStrategyCore The EOS strategy core
+     */
+    void Initialize(UEOSStrategyCore* EOSStrategyCore);
+
+    /**
+     * @brief Event dispatcher for leaderboard query completion.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "EOS|Leaderboards|Event")
+    FOnLeaderboardQueryCompletedDelegate OnLeaderboardQueryCompletedDelegate;
+
+    /** Number of entries in a range page. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EOS|Leaderboards")
+    int32 PageSize = 20;
+
+    /** Seconds a cached page is served without querying the backend, expired pages are evicted. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EOS|Leaderboards")
+    float CacheTTLSeconds = 60.0f;
+
+    /** Whether the pages next to a requested range page are fetched in the background. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EOS|Leaderboards")
+    bool bPrefetchAdjacentPages = true;
+
+    /**
+     * @brief Queries a page of consecutive ranks.
+     *
+     * @param LeaderboardName The name of the leaderboard.
+     * @param StatName The stat the leaderboard is sorted by.
+     * @param PageIndex The page index, starting at 0 for the top ranks.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|Leaderboards|Query")
+    void QueryLeaderboardPage(const FString& LeaderboardName, const FString& StatName, int32 PageIndex);
+
+    /**
+     * @brief Queries the ranks around the local player.
+     *
+     * @param LeaderboardName The name of the leaderboard.
+     * @param StatName The stat the leaderboard is sorted by.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|Leaderboards|Query")
+    void QueryLeaderboardAroundMe(const FString& LeaderboardName, const FString& StatName);
+
+    /**
+     * @brief Queries the ranks of the local player's friends.
+     *
+     * @param LeaderboardName The name of the leaderboard.
+     * @param StatName The stat the leaderboard is sorted by.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|Leaderboards|Query")
+    void QueryLeaderboardFriends(const FString& LeaderboardName, const FString& StatName);
+
+    /**
+     * @brief Drops the cached pages of a leaderboard, for example after the player's stats were flushed.
+     *
+     * Queued prefetches of the leaderboard are dropped and a read already in flight is not cached.
+     *
+     * @param LeaderboardName The name of the leaderboard.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|Leaderboards|Action")
+    void InvalidateLeaderboardCache(const FString& LeaderboardName);
+
+private:
+    // A query waiting for or being read from the backend
+    struct FLeaderboardRequest
+    {
+        FString Key;
+        FLeaderboardPage Page;
+
+        // Whether someone asked for this page, prefetches are only cached
+        bool bBroadcast = false;
+
+        // Whether the leaderboard was invalidated while the page was read, the result is then not cached
+        bool bIsInvalidated = false;
+    };
+
+    // A page stored in the cache
+    struct FCachedLeaderboardPage
+    {
+        TArray<FLeaderboardEntry> Entries;
+        double FetchedAt = 0.0;
+    };
+
+    // Pointer to the EOS strategy core
+    UEOSStrategyCore* EOSStrategyCorePtr;
+
+    // Cached pages keyed by request key, pages relative to the local player include the player's ID
+    TMap<FString, FCachedLeaderboardPage> CachedPages;
+
+    // Queries waiting for the backend, requested pages ahead of prefetches
+    TArray<FLeaderboardRequest> PendingRequests;
+
+    // The query being read, the online subsystem only reports the completion of the last read
+    TOptional<FLeaderboardRequest> ActiveRequest;
+    TSharedPtr<FOnlineLeaderboardRead, ESPMode::ThreadSafe> ActiveReadObject;
+    FDelegateHandle ReadCompleteDelegateHandle;
+
+    FString MakeRequestKey(const FLeaderboardPage& Page) const;
+    void EvictExpiredPages();
+
+    void Query(const FLeaderboardPage& Page, bool bBroadcast);
+    void Prefetch(const FLeaderboardPage& Page);
+    void ProcessNextRequest();
+    bool StartRead(const FLeaderboardRequest& Request, FString& OutError);
+
+    void OnLeaderboardReadCompleted(bool bWasSuccessful);
+    void HandleLeaderboardQueryFailure(const FLeaderboardPage& Page, const FString& ErrorMessage) const;
+};
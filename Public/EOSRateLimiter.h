@@ -0,0 +1,166 @@
+/**
+ * @file EOSRateLimiter.h
+ * 
+ * @brief Author: Marcel Gheorghe Becheanu
+ * @brief Last Updated: October 18, 2026
+ * @brief Github: https://github.com/marcelbecheanu
+ * 
+ * This file contains the declaration of the UEOSRateLimiter class, which throttles backend calls made through EOS.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "EOSRateLimiter.generated.h"
+
+class UEOSStrategyCore;
+
+/**
+ * @brief Backend operations throttled by the rate limiter.
+ */
+UENUM(BlueprintType)
+enum class EBackendOperation : uint8
+{
+    Authenticate,
+    CreateSession,
+    FindSessions,
+    JoinSession,
+    ReadFriends,
+    FindFriendSession,
+    UpdateStats,
+    ReadLeaderboard,
+    ReadStorage,
+    WriteStorage
+};
+
+/**
+ * @brief Lanes used to keep player initiated requests from being starved by automatic ones.
+ *
+ * Both lanes wait for the backoff after failures, they only differ in the interactive reserve.
+ */
+UENUM(BlueprintType)
+enum class ERequestPriority : uint8
+{
+    /** Requests initiated by the player, such as joining a session. */
+    Interactive,
+
+    /** Automatic requests, such as periodic server list refreshes. */
+    Background
+};
+
+USTRUCT(BlueprintType)
+struct FRateLimitBudget
+{
+    GENERATED_BODY()
+
+public:
+    /** Maximum number of requests that can be issued in a burst. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rate Limit")
+    float Capacity = 5.0f;
+
+    /** Number of requests regained per second. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rate Limit")
+    float RefillPerSecond = 1.0f;
+
+    /** Requests kept for the interactive lane, background requests cannot use them. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rate Limit")
+    float InteractiveReserve = 1.0f;
+
+    /** Backoff applied to every request after the first failure, doubled on each consecutive failure. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rate Limit")
+    float BaseBackoffSeconds = 1.0f;
+
+    /** Upper bound for the backoff. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rate Limit")
+    float MaxBackoffSeconds = 60.0f;
+};
+
+/**
+ * @brief Token bucket rate limiter with jittered exponential backoff, shared by all EOS handlers.
+ */
+UCLASS()
+class EOSSTRATEGY_API UEOSRateLimiter : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Initializes the rate limiter with the EOS strategy core.
+     * 
+     * @param EOSStrategyCore The EOS strategy core
+     */
+    void Initialize(UEOSStrategyCore* EOSStrategyCore);
+
+    /**
+     * @brief Overrides the budget of a backend operation.
+     * 
+     * @param Operation The backend operation.
+     * @param Budget The new budget.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|RateLimiter|Action")
+    void SetBudget(EBackendOperation Operation, const FRateLimitBudget& Budget);
+
+    /**
+     * @brief Returns how long a request has to wait before it would be allowed.
+     * 
+     * @param Operation The backend operation.
+     * @param Priority The lane of the request.
+     * @return The delay in seconds, 0 if the request would be allowed now.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|RateLimiter|Query")
+    float GetRetryDelay(EBackendOperation Operation, ERequestPriority Priority);
+
+    /**
+     * @brief Consumes a request from the budget of an operation.
+     * 
+     * @param Operation The backend operation.
+     * @param Priority The lane of the request.
+     * @param OutError The reason the request was rejected.
+     * @return True if the request may be issued, false otherwise.
+     */
+    bool TryAcquire(EBackendOperation Operation, ERequestPriority Priority, FString& OutError);
+
+    /**
+     * @brief Resets the backoff of an operation after a successful backend call.
+     * 
+     * @param Operation The backend operation.
+     */
+    void ReportSuccess(EBackendOperation Operation);
+
+    /**
+     * @brief Extends the backoff of an operation after a failed backend call.
+     * 
+     * @param Operation The backend operation.
+     */
+    void ReportFailure(EBackendOperation Operation);
+
+    /**
+     * @brief Halves the consecutive failures of every operation, for example once the connection is restored.
+     *
+     * The running backoff is kept, only the next failure backs off for a shorter time.
+     */
+    void DecayBackoff();
+
+private:
+    // Runtime state of the bucket of one operation
+    struct FOperationState
+    {
+        float Tokens = 0.0f;
+        double LastRefillTime = 0.0;
+        int32 ConsecutiveFailures = 0;
+        double BackoffUntil = 0.0;
+    };
+
+    // Pointer to the EOS strategy core
+    UEOSStrategyCore* EOSStrategyCorePtr;
+
+    // Budget of each operation, operations without an entry use the default budget
+    TMap<EBackendOperation, FRateLimitBudget> Budgets;
+
+    // Bucket state of each operation
+    TMap<EBackendOperation, FOperationState> States;
+
+    const FRateLimitBudget& GetBudget(EBackendOperation Operation) const;
+    FOperationState& RefillState(EBackendOperation Operation);
+};
@@ -0,0 +1,128 @@
+/**
+ * @file EOSRequestJournal.h
+ * 
+ * @brief Author: Marcel Gheorghe Becheanu
+ * @brief Last Updated: October 18, 2026
+ * @brief Github: https://github.com/marcelbecheanu
+ * 
+ * This file contains the declaration of the UEOSRequestJournal class, which queues backend calls during outages and replays them on reconnection.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Engine/EngineTypes.h"
+#include "OnlineSubsystemTypes.h"
+#include "EOSRateLimiter.h"
+#include "EOSRequestJournal.generated.h"
+
+class UEOSStrategyCore;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnConnectionStateChangedDelegate, bool, bIsOnline);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnRequestQueuedDelegate, EBackendOperation, Operation, int32, NumQueued);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRequestJournalReplayedDelegate, int32, NumReplayed);
+
+/**
+ * @brief Queues eligible backend calls while the connection is down and replays them in priority order once it is back.
+ *
+ * Friends list reads, session searches and stats flushes are queued. Logins, session creation and joins need the
+ * player to act on the result, so they fail right away instead. Calls are not batched, only calls with the same
+ * coalesce key are merged. The replay starts after a random delay and is paced by the rate limiter, so clients
+ * reconnecting after an incident do not all hit the backend at once.
+ */
+UCLASS()
+class EOSSTRATEGY_API UEOSRequestJournal : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Initializes the request journal with the EOS strategy core and listens to connection changes.
+     *
+     * @param EOSStrategyCore The EOS strategy core
+     */
+    void Initialize(UEOSStrategyCore* EOSStrategyCore);
+
+    /**
+     * @brief Event dispatcher for connection loss and recovery.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "EOS|RequestJournal|Event")
+    FOnConnectionStateChangedDelegate OnConnectionStateChangedDelegate;
+
+    /**
+     * @brief Event dispatcher fired when a call is queued instead of being issued.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "EOS|RequestJournal|Event")
+    FOnRequestQueuedDelegate OnRequestQueuedDelegate;
+
+    /**
+     * @brief Event dispatcher fired after the queued calls were replayed.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "EOS|RequestJournal|Event")
+    FOnRequestJournalReplayedDelegate OnRequestJournalReplayedDelegate;
+
+    /** Maximum number of queued calls, the oldest are dropped beyond it. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EOS|RequestJournal")
+    int32 MaxQueuedRequests = 64;
+
+    /** Upper bound of the random delay before the replay starts once the connection is restored. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EOS|RequestJournal")
+    float MaxReplayStartDelaySeconds = 5.0f;
+
+    UFUNCTION(BlueprintCallable, Category = "EOS|RequestJournal|Query")
+    bool IsOffline() const;
+
+    UFUNCTION(BlueprintCallable, Category = "EOS|RequestJournal|Query")
+    int32 GetQueuedRequestCount() const;
+
+    /**
+     * @brief Queues a call while offline instead of letting it fail.
+     *
+     * Calls with the same coalesce key replace each other, so only the latest one is replayed.
+     *
+     * @param Operation The backend operation, which decides the replay order.
+     * @param CoalesceKey Identifies calls that supersede each other.
+     * @param Replay Issues the call again once the connection is back.
+     * @return True if the call was queued and must not be issued now, false if online.
+     */
+    bool DeferIfOffline(EBackendOperation Operation, const FString& CoalesceKey, TFunction<void()>&& Replay);
+
+private:
+    // A call waiting for the connection to come back
+    struct FJournalEntry
+    {
+        EBackendOperation Operation = EBackendOperation::FindSessions;
+        FString CoalesceKey;
+        TFunction<void()> Replay;
+        int64 Sequence = 0;
+    };
+
+    // Pointer to the EOS strategy core
+    UEOSStrategyCore* EOSStrategyCorePtr;
+
+    // Whether the backend is currently unreachable
+    bool bIsOffline = false;
+
+    // Calls queued during the outage
+    TArray<FJournalEntry> Entries;
+
+    // Order in which the calls were queued
+    int64 NextSequence = 0;
+
+    // Calls being replayed in order, the next one is issued once the rate limiter allows it
+    TArray<FJournalEntry> ReplayQueue;
+
+    // Number of calls replayed since the connection was restored
+    int32 NumReplayed = 0;
+
+    // Starts the replay and paces the replayed calls
+    FTimerHandle ReplayTimerHandle;
+
+    static int32 GetReplayRank(EBackendOperation Operation);
+
+    void OnConnectionStatusChanged(const FString& ServiceName, EOnlineServerConnectionStatus::Type LastConnectionState, EOnlineServerConnectionStatus::Type ConnectionState);
+    void StartReplay();
+    void StopReplay();
+    void ReplayNextEntry();
+};
@@ -15,6 +15,7 @@
 
 
 class UEOSStrategyCore;
+class UEOSSessionPresetAsset;
 
 USTRUCT(BlueprintType)
 struct FConnectionSettings
@@ -98,6 +99,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Settings")
 	FString WorldPath = FString("");
 
+	/** The region advertised for this session, used to partition sharded searches. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Settings")
+	FString Region = FString("");
+
 	/** The port number for the server associated with this session. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session Settings")
 	int32 PortServer = 3000;
@@ -115,25 +120,98 @@ struct FSearchSettings
 public:
 	
 	/** Whether the query is intended for LAN matches or not */
-    UPROPERTY(BlueprintReadWrite, Category = "Search Settings")
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Search Settings")
     bool bIsLanQuery = false;
 
     /** Max number of queries returned by the matchmaking service */
-    UPROPERTY(BlueprintReadWrite, Category = "Search Settings")
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Search Settings")
     int32 MaxSearchResults = 1000000;
 
     /** Used to sort games into buckets since a the difference in terms of feel for ping in the same bucket is often not a useful comparison and skill is better */
-    UPROPERTY(BlueprintReadWrite, Category = "Search Settings")
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Search Settings")
     int32 PingBucketSize = 0;
 
     /** Search hash used by the online subsystem to disambiguate search queries, stamped every time FindSession is called */
-    UPROPERTY(BlueprintReadWrite, Category = "Search Settings")
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Search Settings")
     int32 PlatformHash = 0;
 
     /** Amount of time to wait for the search results. May not apply to all platforms. */
-    UPROPERTY(BlueprintReadWrite, Category = "Search Settings")
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Search Settings")
     float TimeoutInSeconds = 0.0f;
 
+    /** Whether this search is an automatic refresh, which cannot use the requests kept for player initiated searches. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Search Settings")
+    bool bIsBackgroundRefresh = false;
+
+};
+
+UENUM(BlueprintType)
+enum class ESessionSortKey : uint8
+{
+	/** Lowest ping first. */
+	Ping,
+
+	/** Most players first. */
+	Players,
+
+	/** Most open slots first. */
+	OpenSlots,
+
+	/** Alphabetical by session name. */
+	Name
+};
+
+USTRUCT(BlueprintType)
+struct FSearchShard
+{
+	GENERATED_BODY()
+
+public:
+	/** Only sessions advertised in this region, empty for any region. */
+	UPROPERTY(BlueprintReadWrite, Category = "Search Settings")
+	FString Region = FString("");
+
+	/** Only sessions running this world, empty for any world. */
+	UPROPERTY(BlueprintReadWrite, Category = "Search Settings")
+	FString World = FString("");
+
+	/** Only sessions created with this build id, 0 for any build. */
+	UPROPERTY(BlueprintReadWrite, Category = "Search Settings")
+	int32 BuildUniqueId = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FShardedSearchSettings
+{
+	GENERATED_BODY()
+
+public:
+	/** Settings applied to every shard. */
+	UPROPERTY(BlueprintReadWrite, Category = "Search Settings")
+	FSearchSettings SearchSettings;
+
+	/** Partitions searched concurrently, results are merged and deduplicated by session ID. */
+	UPROPERTY(BlueprintReadWrite, Category = "Search Settings")
+	TArray<FSearchShard> Shards;
+
+	/** Order of the merged results. */
+	UPROPERTY(BlueprintReadWrite, Category = "Search Settings")
+	ESessionSortKey SortKey = ESessionSortKey::Ping;
+
+	/**
+	 * The results are delivered as soon as this many are merged, 0 waits for every shard. Shards still running may hold
+	 * better ranked sessions, so an early list is approximate. Their results still update the session delta and the cache.
+	 */
+	UPROPERTY(BlueprintReadWrite, Category = "Search Settings")
+	int32 DesiredResults = 50;
+
+	/** Seconds after which the merged results are delivered without waiting for the slower shards, 0 for no deadline. */
+	UPROPERTY(BlueprintReadWrite, Category = "Search Settings")
+	float ShardTimeoutSeconds = 0.0f;
+
+	/** Maximum number of shards searched at the same time. */
+	UPROPERTY(BlueprintReadWrite, Category = "Search Settings")
+	int32 MaxConcurrentShards = 4;
 };
 
 USTRUCT(BlueprintType)
@@ -163,6 +241,27 @@ public:
 		
 		CurrentPlayers = Session.SessionSettings.NumPublicConnections - Session.NumOpenPublicConnections;
 		MaxPlayers = Session.SessionSettings.NumPublicConnections;
+
+		LastSeen = FDateTime::UtcNow();
+		Fingerprint = ComputeFingerprint();
+	}
+
+	/**
+	 * @brief Hashes the attributes shown to the player, used to detect changed sessions between searches.
+	 *
+	 * Ping is quantized so that small jitter does not mark every session as changed on each refresh.
+	 *
+	 * @return The fingerprint of this session server.
+	 */
+	uint32 ComputeFingerprint() const
+	{
+		uint32 Hash = GetTypeHash(Name);
+		Hash = HashCombine(Hash, GetTypeHash(World));
+		Hash = HashCombine(Hash, GetTypeHash(Ping / 10));
+		Hash = HashCombine(Hash, GetTypeHash(CurrentPlayers));
+		Hash = HashCombine(Hash, GetTypeHash(MaxPlayers));
+		Hash = HashCombine(Hash, GetTypeHash(bIsCached));
+		return Hash;
 	}
 	
 	UPROPERTY(BlueprintReadWrite, Category = "Session Server")
@@ -182,13 +281,43 @@ public:
 	
 	UPROPERTY(BlueprintReadWrite, Category = "Session Server")
 	int32 MaxPlayers = 0;
-	
+
+	/** Whether this entry was loaded from the on-disk server list and has not been seen by a live search yet. Cached entries cannot be joined. */
+	UPROPERTY(BlueprintReadWrite, Category = "Session Server")
+	bool bIsCached = false;
+
+	/** When this session was last returned by a live search (UTC). */
+	UPROPERTY(BlueprintReadWrite, Category = "Session Server")
+	FDateTime LastSeen;
+
+	// Fingerprint of the displayed attributes, see ComputeFingerprint.
+	uint32 Fingerprint = 0;
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCreateOnlineSessionCompletedDelegate, bool, bWasSuccessful, FString, Error);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnFindOnlineSessionCompletedDelegate, const TArray<FSessionServer>&, Sessions, bool, bWasSuccessful, FString, Error);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnFindOnlineSessionDeltaDelegate, const TArray<FSessionServer>&, Added, const TArray<FSessionServer>&, Changed, const TArray<FString>&, Removed);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnShardedSearchProgressDelegate, const TArray<FSessionServer>&, Sessions, int32, CompletedShards, int32, TotalShards);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCachedOnlineSessionsLoadedDelegate, const TArray<FSessionServer>&, Sessions, FDateTime, SavedAt);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnJoinOnlineSessionCompletedDelegate, bool, bWasSuccessful, FString, Error);
 
+/**
+ * @brief Contents of the on-disk server list cache.
+ */
+struct FSessionServerCache
+{
+	// When the cache was written (UTC)
+	FDateTime SavedAt;
+
+	// Results of the last successful search
+	TArray<FSessionServer> Servers;
+
+	// Servers marked as favorite by the player
+	TArray<FSessionServer> FavoriteServers;
+
+	// Servers the player joined recently, most recent first
+	TArray<FSessionServer> RecentServers;
+};
 
 UCLASS()
 class EOSSTRATEGY_API UEOSSession : public UObject
@@ -204,7 +333,25 @@ public:
 	void Initialize(UEOSStrategyCore* EOSStrategyCore);
 
 	UFUNCTION(BlueprintCallable, Category= "EOS|Session|Action")
-	void CreateOnlineSession(FSessionInfo SessionInfo);
+	void CreateOnlineSession(const FSessionInfo& SessionInfo);
+
+	/**
+	 * @brief Creates a session from a registered preset.
+	 *
+	 * @param PresetName The name of the session preset.
+	 * @param SessionName The advertised name of the session, empty to keep the preset's name.
+	 */
+	UFUNCTION(BlueprintCallable, Category= "EOS|Session|Action")
+	void CreateOnlineSessionFromPreset(FName PresetName, const FString& SessionName);
+
+	/**
+	 * @brief Validates and registers the session and search presets of an asset.
+	 *
+	 * @param PresetAsset The asset holding the presets.
+	 * @return True if every preset is valid, false if any was rejected.
+	 */
+	UFUNCTION(BlueprintCallable, Category= "EOS|Session|Action")
+	bool RegisterSessionPresets(const UEOSSessionPresetAsset* PresetAsset);
 	
 	/**
 	* @brief Event dispatcher for Create Online Session completion.
@@ -215,15 +362,84 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "EOS|Session|Event")
 	FOnFindOnlineSessionCompletedDelegate OnFindOnlineSessionCompletedDelegate;
 
+	/**
+	* @brief Event dispatcher with the sessions added, changed and removed since the previous search.
+	*/
+	UPROPERTY(BlueprintAssignable, Category = "EOS|Session|Event")
+	FOnFindOnlineSessionDeltaDelegate OnFindOnlineSessionDeltaDelegate;
+
+	/**
+	* @brief Event dispatcher with the merged results so far, fired each time a shard of a sharded search completes.
+	*/
+	UPROPERTY(BlueprintAssignable, Category = "EOS|Session|Event")
+	FOnShardedSearchProgressDelegate OnShardedSearchProgressDelegate;
+
+	/**
+	* @brief Event dispatcher fired at startup with the aged server list loaded from disk.
+	*/
+	UPROPERTY(BlueprintAssignable, Category = "EOS|Session|Event")
+	FOnCachedOnlineSessionsLoadedDelegate OnCachedOnlineSessionsLoadedDelegate;
+
 	UPROPERTY(BlueprintAssignable, Category = "EOS|Session|Event")
 	FOnJoinOnlineSessionCompletedDelegate OnJoinOnlineSessionCompletedDelegate;
 
 
 	UFUNCTION(BlueprintCallable, Category = "EOS|Session|Query")
-	void FindOnlineSessions(FSearchSettings SearchSettings);
+	void FindOnlineSessions(const FSearchSettings& SearchSettings);
+
+	/**
+	 * @brief Searches sessions with a registered search preset.
+	 *
+	 * @param PresetName The name of the search preset.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EOS|Session|Query")
+	void FindOnlineSessionsFromPreset(FName PresetName);
+
+	/**
+	 * @brief Searches several partitions of the sessions concurrently and merges their results.
+	 *
+	 * Partial results are streamed through OnShardedSearchProgressDelegate, the final list is
+	 * delivered through OnFindOnlineSessionCompletedDelegate like a regular search. When the list is delivered
+	 * early, the search keeps running in the background until the remaining shards complete.
+	 *
+	 * @param InShardedSearchSettings The shards and the merge options.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EOS|Session|Query")
+	void FindShardedOnlineSessions(const FShardedSearchSettings& InShardedSearchSettings);
 
 	UFUNCTION(BlueprintCallable, Category= "EOS|Session|Action")
 	void JoinOnlineSession(FSessionServer SessionServer);
+
+	/**
+	 * @brief Forgets the previous search results, so the next search reports every session as added.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EOS|Session|Action")
+	void ResetSessionDelta();
+
+	/**
+	 * @brief Marks a session server as favorite and persists it to the server list cache.
+	 *
+	 * @param SessionServer The session server to add.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EOS|Session|Action")
+	void AddFavoriteServer(const FSessionServer& SessionServer);
+
+	/**
+	 * @brief Removes a session server from the favorites.
+	 *
+	 * @param ServerID The ID of the session server to remove.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EOS|Session|Action")
+	void RemoveFavoriteServer(const FString& ServerID);
+
+	UFUNCTION(BlueprintCallable, Category = "EOS|Session|Query")
+	bool IsFavoriteServer(const FString& ServerID) const;
+
+	UFUNCTION(BlueprintCallable, Category = "EOS|Session|Query")
+	TArray<FSessionServer> GetFavoriteServers() const;
+
+	UFUNCTION(BlueprintCallable, Category = "EOS|Session|Query")
+	TArray<FSessionServer> GetRecentServers() const;
 	
 private:
 	// Pointer to the EOS strategy core
@@ -235,13 +451,111 @@ private:
 	// Used to Storage Sessions
 	TSharedPtr<class FOnlineSessionSearch> OnlineSessionSearch;
 
+	// State of one shard of a sharded search
+	struct FShardSearch
+	{
+		FSearchShard Shard;
+		TSharedPtr<FOnlineSessionSearch> Search;
+		TArray<FSessionServer> SortedResults;
+		bool bInFlight = false;
+		bool bDone = false;
+		bool bWasSuccessful = false;
+	};
+
+	// Settings of the running sharded search
+	FShardedSearchSettings ShardedSearchSettings;
+
+	// Shards of the running sharded search, empty when none is running. Kept until every shard started has reported
+	TArray<FShardSearch> ShardSearches;
+
+	// Handle of the find sessions delegate bound by the sharded search
+	FDelegateHandle ShardedSearchDelegateHandle;
+
+	// Delivers the sharded results once ShardTimeoutSeconds elapsed
+	FTimerHandle ShardDeadlineTimerHandle;
+
+	// Whether the results of the running sharded search were delivered before every shard completed
+	bool bHasDeliveredShardedResults = false;
+
+	// Whether shard searches are being started, completions raised meanwhile are collected afterwards
+	bool bIsLaunchingShards = false;
+
+	// Handle of the join session delegate bound by the running join
+	FDelegateHandle JoinSessionDelegateHandle;
+
+	// A validated session preset with its settings built once at registration, immutable afterwards
+	struct FSessionPreset
+	{
+		FSessionInfo SessionInfo;
+		TSharedRef<const FOnlineSessionSettings> Settings;
+	};
+
+	// Registered session presets
+	TMap<FName, FSessionPreset> SessionPresets;
+
+	// Registered search presets
+	TMap<FName, FSearchSettings> SearchPresets;
+
+	// Results of the previous search keyed by session ID, used to compute the delta of the next one
+	TMap<FString, FSessionServer> KnownSessionServers;
+
+	// Whether a live search has completed, after which the on-disk cache is stale
+	bool bHasLiveSessionServers = false;
+
+	// Servers marked as favorite by the player
+	TArray<FSessionServer> FavoriteServers;
+
+	// Servers the player joined recently, most recent first
+	TArray<FSessionServer> RecentServers;
+
+	// Session server being joined, recorded as recent once the join succeeds
+	FSessionServer PendingJoinServer;
+
+	// Whether the on-disk server list cache was loaded, or found missing
+	bool bIsServerCacheLoaded = false;
+
+	// Whether a write of the server list cache is running
+	bool bIsSavingServerCache = false;
+
+	// Whether the server list changed while the cache was being written
+	bool bIsServerCacheDirty = false;
+
+	// Maximum number of recently played servers kept in the cache
+	static constexpr int32 MaxRecentServers = 10;
+
+	FString GetServerCachePath() const;
+	void LoadServerCacheAsync();
+	void ApplyServerCache(const FSessionServerCache& Cache);
+	void SaveServerCache();
+	void OnServerCacheSaved();
+
+	static bool ValidateSessionInfo(const FSessionInfo& SessionInfo, FString& OutError);
+	static bool ValidateSearchSettings(const FSearchSettings& SearchSettings, FString& OutError);
+	static void BuildOnlineSessionSettings(const FSessionInfo& SessionInfo, FOnlineSessionSettings& OutSessionSettings);
+	bool CanCreateOnlineSession(const FConnectionSettings& ConnectionSettings) const;
+	void StartCreateOnlineSession(const FOnlineSessionSettings& SessionSettings);
+
 	void OnCreateOnlineSessionCompleted(FName SessionName, bool bWasSuccessful);
 	void HandleSessionCreationFailure(const FString& ErrorMessage) const;
 
+	bool IsSessionSearchInProgress() const;
 	void OnFindOnlineSessionsCompleted(bool bWasSuccess);
 	void HandleFindOnlineSessionsFailure(const FString& ErrorMessage) const;
-
-	void OnJoinSessionCompleted(FName SessionName, EOnJoinSessionCompleteResult::Type Result) const;
+	void PublishSessionServers(const TArray<FSessionServer>& Servers);
+	void BroadcastSessionServers(const TArray<FSessionServer>& Servers) const;
+	void UpdateKnownSessionServers(const TArray<FSessionServer>& Servers);
+
+	TSharedRef<FOnlineSessionSearch> MakeOnlineSessionSearch(const FSearchSettings& SearchSettings) const;
+	void LaunchShardSearches();
+	bool CollectCompletedShards();
+	void OnShardSearchCompleted(bool bWasSuccess);
+	void UpdateShardedSearch();
+	void OnShardedSearchDeadline();
+	TArray<FSessionServer> MergeShardResults(int32 Limit) const;
+	void DeliverShardedResults();
+	void FinishShardedSearch();
+
+	void OnJoinSessionCompleted(FName SessionName, EOnJoinSessionCompleteResult::Type Result);
 	void HandleJoinOnlineSessionFailure(const FString& ErrorMessage) const;
 
 };
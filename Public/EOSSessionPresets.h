@@ -0,0 +1,34 @@
+/**
+ * @file EOSSessionPresets.h
+ * 
+ * @brief Author: Marcel Gheorghe Becheanu
+ * @brief Last Updated: October 18, 2026
+ * @brief Github: https://github.com/marcelbecheanu
+ * 
+ * This file contains the declaration of the UEOSSessionPresetAsset class, which defines named session and search presets.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "EOSSession.h"
+#include "EOSSessionPresets.generated.h"
+
+/**
+ * @brief Named session and search presets, validated and built once when registered with UEOSSession.
+ */
+UCLASS(BlueprintType)
+class EOSSTRATEGY_API UEOSSessionPresetAsset : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Session presets used by CreateOnlineSessionFromPreset. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Session Presets")
+	TMap<FName, FSessionInfo> SessionPresets;
+
+	/** Search presets used by FindOnlineSessionsFromPreset. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Session Presets")
+	TMap<FName, FSearchSettings> SearchPresets;
+};
@@ -0,0 +1,182 @@
+/**
+ * @file EOSStats.h
+ * 
+ * @brief Author: Marcel Gheorghe Becheanu
+ * @brief Last Updated: October 18, 2026
+ * @brief Github: https://github.com/marcelbecheanu
+ * 
+ * This file contains the declaration of the UEOSStats class, which batches stat updates sent to EOS.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Engine/EngineTypes.h"
+#include "Async/Future.h"
+#include "EOSStats.generated.h"
+
+class UEOSStrategyCore;
+struct FOnlineError;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnStatsFlushedDelegate, bool, bWasSuccessful, int32, NumStats, float, LatencySeconds, FString, Error);
+
+/**
+ * @brief Coalesces stat increments per user and stat, flushes them in batches and journals them to disk until they are sent.
+ *
+ * Stats are summed by the backend, which cannot tell whether a batch was already applied. Shutdown therefore waits
+ * up to ShutdownFlushTimeoutSeconds for the batch in flight. A batch still unconfirmed after that is logged and dropped
+ * on the next launch rather than sent twice, only increments that were never sent are restored from the journal.
+ */
+UCLASS()
+class EOSSTRATEGY_API UEOSStats : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Initializes the stats handler with the EOS strategy core and restores the journal.
+     *
+     * @param EOSStrategyCore The EOS strategy core
+     */
+    void Initialize(UEOSStrategyCore* EOSStrategyCore);
+
+    /**
+     * @brief Stops the timers, waits for the batch in flight and writes the unflushed stats to the journal.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Event dispatcher for batch flush completion.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "EOS|Stats|Event")
+    FOnStatsFlushedDelegate OnStatsFlushedDelegate;
+
+    /** Seconds between automatic flushes, see SetFlushInterval. */
+    UPROPERTY(BlueprintReadOnly, Category = "EOS|Stats")
+    float FlushIntervalSeconds = 30.0f;
+
+    /** Seconds between journal writes while there are unsaved increments, see SetJournalInterval. */
+    UPROPERTY(BlueprintReadOnly, Category = "EOS|Stats")
+    float JournalIntervalSeconds = 2.0f;
+
+    /** Maximum time Shutdown waits for the backend to confirm the batch in flight. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EOS|Stats")
+    float ShutdownFlushTimeoutSeconds = 2.0f;
+
+    /**
+     * @brief Changes the time between automatic flushes and restarts the flush timer.
+     *
+     * @param Seconds The new interval in seconds.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|Stats|Action")
+    void SetFlushInterval(float Seconds);
+
+    /**
+     * @brief Changes the time between journal writes and restarts the journal timer.
+     *
+     * @param Seconds The new interval in seconds.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|Stats|Action")
+    void SetJournalInterval(float Seconds);
+
+    /**
+     * @brief Adds to a stat of the local player. Increments are only sent on the next flush.
+     *
+     * @param StatName The name of the stat.
+     * @param Amount The amount to add.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|Stats|Action")
+    void IncrementStat(const FString& StatName, int32 Amount);
+
+    /**
+     * @brief Adds to a stat of any user, used by dedicated servers.
+     *
+     * @param UserID The user's ID.
+     * @param StatName The name of the stat.
+     * @param Amount The amount to add.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|Stats|Action")
+    void IncrementUserStat(const FString& UserID, const FString& StatName, int32 Amount);
+
+    /**
+     * @brief Sends every pending increment in a single batch, for example at the end of a match.
+     *
+     * If a batch is already in flight the flush runs once it completes. If the flush cannot be sent now,
+     * OnStatsFlushedDelegate reports why and the increments stay queued.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|Stats|Action")
+    void FlushStats();
+
+    /**
+     * @brief Returns the number of user stats waiting to be sent, including the batch in flight.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|Stats|Query")
+    int32 GetQueueDepth() const;
+
+    /**
+     * @brief Returns the duration of the last completed flush in seconds.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|Stats|Query")
+    float GetLastFlushLatency() const;
+
+private:
+    // Stat increments keyed by user ID, then by stat name
+    typedef TMap<FString, TMap<FString, int32>> FUserStatIncrements;
+
+    // Pointer to the EOS strategy core
+    UEOSStrategyCore* EOSStrategyCorePtr;
+
+    // Increments not sent yet
+    FUserStatIncrements PendingStats;
+
+    // Increments of the batch waiting for the backend, merged back into PendingStats on failure
+    FUserStatIncrements InFlightStats;
+
+    // Identifies the batch in flight in the journal
+    FGuid InFlightBatchId;
+
+    // Whether the batch in flight was handed to the backend, it is only sent once the journal records it
+    bool bIsBatchSent = false;
+
+    // Whether a journal write is running on the thread pool
+    bool bIsWritingJournal = false;
+
+    // Whether Shutdown is waiting for the batch in flight, no new batch is started meanwhile
+    bool bIsShuttingDown = false;
+
+    // The running journal write, waited for before the final write on shutdown
+    TFuture<void> JournalWriteFuture;
+
+    // Whether a flush was requested while a batch was in flight
+    bool bIsFlushQueued = false;
+
+    // Whether the increments changed since the journal was last written
+    bool bIsJournalDirty = false;
+
+    // Time the batch in flight was sent
+    double FlushStartTime = 0.0;
+
+    // Duration of the last completed flush
+    float LastFlushLatency = 0.0f;
+
+    FTimerHandle FlushTimerHandle;
+    FTimerHandle JournalTimerHandle;
+    FTimerHandle RetryTimerHandle;
+
+    static void AddIncrements(FUserStatIncrements& Target, const FUserStatIncrements& Source);
+    static int32 CountStats(const FUserStatIncrements& Increments);
+
+    static bool SaveJournal(const TArray<uint8>& Data, const FString& Path);
+
+    FString GetJournalPath() const;
+    TArray<uint8> SerializeJournal();
+    void LoadJournal();
+    void WriteJournal();
+    void WriteJournalIfDirty();
+    void OnJournalWritten(const FGuid& WrittenBatchId);
+
+    void SendInFlightBatch();
+    void OnFlushStatsCompleted(const FOnlineError& Result);
+    void HandleFlushStatsFailure(const FString& ErrorMessage) const;
+};
@@ -0,0 +1,242 @@
+/**
+ * @file EOSStorage.h
+ * 
+ * @brief Author: Marcel Gheorghe Becheanu
+ * @brief Last Updated: October 18, 2026
+ * @brief Github: https://github.com/marcelbecheanu
+ * 
+ * This file contains the declaration of the UEOSStorage class, which transfers title and player storage files and caches them locally.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Engine/EngineTypes.h"
+#include "OnlineSubsystemTypes.h"
+#include "EOSStorage.generated.h"
+
+class UEOSStrategyCore;
+
+UENUM(BlueprintType)
+enum class EStorageType : uint8
+{
+    /** Files shared by every player, such as configuration blobs. Read only. */
+    Title,
+
+    /** Files owned by the local player, such as save data. */
+    Player
+};
+
+USTRUCT(BlueprintType)
+struct FStorageMetrics
+{
+    GENERATED_BODY()
+
+public:
+    /** Bytes downloaded from the backend. */
+    UPROPERTY(BlueprintReadOnly, Category = "Storage")
+    int64 BytesDownloaded = 0;
+
+    /** Bytes uploaded to the backend. */
+    UPROPERTY(BlueprintReadOnly, Category = "Storage")
+    int64 BytesUploaded = 0;
+
+    /** Bytes served from the local cache or skipped because the backend already had them. */
+    UPROPERTY(BlueprintReadOnly, Category = "Storage")
+    int64 BytesFromCache = 0;
+
+    /** Transfers avoided thanks to the local cache. */
+    UPROPERTY(BlueprintReadOnly, Category = "Storage")
+    int32 CacheHits = 0;
+
+    /** Transfers that had to go to the backend. */
+    UPROPERTY(BlueprintReadOnly, Category = "Storage")
+    int32 CacheMisses = 0;
+
+    /** Average throughput of the completed backend transfers in bytes per second. */
+    UPROPERTY(BlueprintReadOnly, Category = "Storage")
+    float ThroughputBytesPerSecond = 0.0f;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnStorageFileListCompletedDelegate, EStorageType, StorageType, const TArray<FString>&, FileNames, bool, bWasSuccessful, FString, Error);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnStorageFileProgressDelegate, EStorageType, StorageType, FString, FileName, int64, BytesTransferred, int64, TotalBytes);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FOnStorageFileChunkDelegate, EStorageType, StorageType, FString, FileName, const TArray<uint8>&, Chunk, int64, Offset, int64, TotalBytes);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FOnStorageFileCompletedDelegate, EStorageType, StorageType, FString, FileName, bool, bWasSuccessful, bool, bFromCache, FString, Error);
+
+/**
+ * @brief Downloads and uploads storage files concurrently, serving unchanged files from a local content-addressed cache.
+ */
+UCLASS()
+class EOSSTRATEGY_API UEOSStorage : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Initializes the storage handler with the EOS strategy core.
+     *
+     * @param EOSStrategyCore The EOS strategy core
+     */
+    void Initialize(UEOSStrategyCore* EOSStrategyCore);
+
+    /**
+     * @brief Event dispatcher for file list completion.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "EOS|Storage|Event")
+    FOnStorageFileListCompletedDelegate OnStorageFileListCompletedDelegate;
+
+    /**
+     * @brief Event dispatcher with the progress of a backend transfer.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "EOS|Storage|Event")
+    FOnStorageFileProgressDelegate OnStorageFileProgressDelegate;
+
+    /**
+     * @brief Event dispatcher streaming the contents of a read file in chunks of ChunkSize bytes.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "EOS|Storage|Event")
+    FOnStorageFileChunkDelegate OnStorageFileChunkDelegate;
+
+    /**
+     * @brief Event dispatcher for read and write completion.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "EOS|Storage|Event")
+    FOnStorageFileCompletedDelegate OnStorageFileCompletedDelegate;
+
+    /** Size of the chunks streamed through OnStorageFileChunkDelegate. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EOS|Storage")
+    int32 ChunkSize = 256 * 1024;
+
+    /** Maximum number of files transferred at the same time. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EOS|Storage")
+    int32 MaxConcurrentTransfers = 4;
+
+    /** Maximum size of the on-disk cache, the least recently used entries are deleted beyond it. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EOS|Storage")
+    int64 MaxCacheSizeBytes = 256 * 1024 * 1024;
+
+    /** Maximum size of the file contents kept in memory for GetStorageFileContents, the least recently read are dropped beyond it. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EOS|Storage")
+    int64 MaxInMemoryBytes = 64 * 1024 * 1024;
+
+    /**
+     * @brief Enumerates the files of a storage, required to serve reads from the cache.
+     *
+     * @param StorageType The storage to enumerate.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|Storage|Query")
+    void RefreshFileList(EStorageType StorageType);
+
+    /**
+     * @brief Reads a file, from the local cache if the last file list or write of this session reports the same contents.
+     *
+     * @param StorageType The storage to read from.
+     * @param FileName The name of the file.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|Storage|Action")
+    void ReadStorageFile(EStorageType StorageType, const FString& FileName);
+
+    /**
+     * @brief Writes a file to the player storage, skipped if the backend already has the same contents.
+     *
+     * @param FileName The name of the file.
+     * @param Contents The contents of the file.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|Storage|Action")
+    void WritePlayerStorageFile(const FString& FileName, const TArray<uint8>& Contents);
+
+    /**
+     * @brief Returns the contents of a file after it was read.
+     *
+     * @param StorageType The storage the file was read from.
+     * @param FileName The name of the file.
+     * @param OutContents The contents of the file.
+     * @return True if the file was read and is still in memory, false otherwise.
+     */
+    UFUNCTION(BlueprintCallable, Category = "EOS|Storage|Query")
+    bool GetStorageFileContents(EStorageType StorageType, const FString& FileName, TArray<uint8>& OutContents) const;
+
+    UFUNCTION(BlueprintCallable, Category = "EOS|Storage|Query")
+    FStorageMetrics GetStorageMetrics() const;
+
+private:
+    // A read or write waiting for or being transferred by the backend
+    struct FStorageTransfer
+    {
+        EStorageType StorageType = EStorageType::Title;
+        FString FileName;
+        bool bIsWrite = false;
+        TArray<uint8> Contents;
+        FString ContentHash;
+        int64 TotalBytes = 0;
+        double StartTime = 0.0;
+    };
+
+    // Pointer to the EOS strategy core
+    UEOSStrategyCore* EOSStrategyCorePtr;
+
+    // What the backend reported about a file
+    struct FRemoteFileInfo
+    {
+        FString Hash;
+        FName HashType;
+        int64 Size = 0;
+
+        // Whether the hash comes from the latest file list or a confirmed write, only then can the cache be trusted
+        bool bIsConfirmed = false;
+    };
+
+    // Files known to the backend, keyed by transfer key
+    TMap<FString, FRemoteFileInfo> RemoteFiles;
+
+    // Contents of the files read so far, keyed by transfer key
+    TMap<FString, TArray<uint8>> FileContents;
+
+    // Keys of FileContents, least recently stored first
+    TArray<FString> FileContentsOrder;
+
+    // Total size of FileContents
+    int64 FileContentsBytes = 0;
+
+    // Transfers waiting for a free slot
+    TArray<FStorageTransfer> QueuedTransfers;
+
+    // Transfers in flight, keyed by transfer key
+    TMap<FString, FStorageTransfer> ActiveTransfers;
+
+    FStorageMetrics Metrics;
+
+    // Total time spent in completed backend transfers, used for the throughput
+    double TransferSeconds = 0.0;
+
+    // Retries the queue once the rate limiter allows it
+    FTimerHandle RetryTimerHandle;
+
+    static FString MakeTransferKey(EStorageType StorageType, const FString& FileName);
+    static FString HashContents(const TArray<uint8>& Contents, FName HashType);
+
+    FString GetCacheDirectory() const;
+    FString GetCachePath(const FString& ContentHash) const;
+    FUniqueNetIdPtr GetLocalUserId() const;
+    void UpdateRemoteFiles(EStorageType StorageType, const TArray<FCloudFileHeader>& Files, TArray<FString>& OutFileNames);
+    void SetRemoteHash(FRemoteFileInfo& RemoteFile, const FString& Hash);
+    void TrimCacheAsync() const;
+    void StoreFileContents(const FString& TransferKey, TArray<uint8>&& Contents);
+
+    void ServeFromCache(EStorageType StorageType, const FString& FileName, const FRemoteFileInfo& RemoteFile);
+    void CompleteRead(EStorageType StorageType, const FString& FileName, TArray<uint8>&& Contents, bool bFromCache);
+    void ProcessTransferQueue();
+    void EnqueueTransfer(FStorageTransfer&& Transfer);
+    bool StartTransfer(FStorageTransfer& Transfer);
+    void FinishTransfer(const FString& TransferKey, bool bWasSuccessful);
+    void HandleStorageFailure(EStorageType StorageType, const FString& FileName, const FString& ErrorMessage) const;
+
+    void OnEnumerateTitleFilesCompleted(bool bWasSuccessful, const FString& Error);
+    void OnEnumerateUserFilesCompleted(bool bWasSuccessful, const FUniqueNetId& UserId);
+    void OnTitleFileProgress(const FString& FileName, uint64 NumBytes);
+    void OnTitleFileReadCompleted(bool bWasSuccessful, const FString& FileName);
+    void OnUserFileReadCompleted(bool bWasSuccessful, const FUniqueNetId& UserId, const FString& FileName);
+    void OnUserFileWriteProgress(int32 BytesWritten, const FUniqueNetId& UserId, const FString& FileName);
+    void OnUserFileWriteCompleted(bool bWasSuccessful, const FUniqueNetId& UserId, const FString& FileName);
+};
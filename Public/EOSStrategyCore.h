@@ -10,8 +10,15 @@
 #pragma once
 
 #include "EOSSession.h"
+#include "EOSSessionPresets.h"
 #include "EOSProfile.h"
+#include "EOSFriends.h"
+#include "EOSStats.h"
+#include "EOSLeaderboards.h"
+#include "EOSStorage.h"
 #include "EOSAuthenticator.h"
+#include "EOSRateLimiter.h"
+#include "EOSRequestJournal.h"
 #include "OnlineSubsystem.h"
 #include "CoreMinimal.h"
 #include "Engine/GameInstance.h"
@@ -50,6 +57,10 @@ public:
      UFUNCTION(BlueprintCallable,Category = "EOS|Session|Query")
      UEOSSession* GetSession();
 
+    // Session and search presets registered with the EOS Session Module at startup.
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "EOS|Session")
+    TArray<UEOSSessionPresetAsset*> SessionPresetAssets;
+
      // Reference to the EOS Authenticator Module.
      UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "EOS|Profile")
      UEOSProfile* Profile;
@@ -61,6 +72,78 @@ public:
       */
      UFUNCTION(BlueprintCallable,Category = "EOS|Profile|Query")
      UEOSProfile* GetProfile();
+
+    // Reference to the EOS Friends Module.
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "EOS|Friends")
+    UEOSFriends* Friends;
+
+    /**
+     * @brief Retrieves the EOS Friends Module.
+     * 
+     * @return A pointer to the EOS Friends Module.
+     */
+    UFUNCTION(BlueprintCallable,Category = "EOS|Friends|Query")
+    UEOSFriends* GetFriends();
+
+    // Reference to the EOS Stats Module.
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "EOS|Stats")
+    UEOSStats* Stats;
+
+    /**
+     * @brief Retrieves the EOS Stats Module.
+     * 
+     * @return A pointer to the EOS Stats Module.
+     */
+    UFUNCTION(BlueprintCallable,Category = "EOS|Stats|Query")
+    UEOSStats* GetStats();
+
+    // Reference to the EOS Leaderboards Module.
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "EOS|Leaderboards")
+    UEOSLeaderboards* Leaderboards;
+
+    /**
+     * @brief Retrieves the EOS Leaderboards Module.
+     * 
+     * @return A pointer to the EOS Leaderboards Module.
+     */
+    UFUNCTION(BlueprintCallable,Category = "EOS|Leaderboards|Query")
+    UEOSLeaderboards* GetLeaderboards();
+
+    // Reference to the EOS Storage Module.
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "EOS|Storage")
+    UEOSStorage* Storage;
+
+    /**
+     * @brief Retrieves the EOS Storage Module.
+     * 
+     * @return A pointer to the EOS Storage Module.
+     */
+    UFUNCTION(BlueprintCallable,Category = "EOS|Storage|Query")
+    UEOSStorage* GetStorage();
+
+    // Reference to the EOS Rate Limiter shared by all handlers.
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "EOS|RateLimiter")
+    UEOSRateLimiter* RateLimiter;
+
+    /**
+     * @brief Retrieves the EOS Rate Limiter.
+     * 
+     * @return A pointer to the EOS Rate Limiter.
+     */
+    UFUNCTION(BlueprintCallable,Category = "EOS|RateLimiter|Query")
+    UEOSRateLimiter* GetRateLimiter();
+
+    // Reference to the EOS Request Journal shared by all handlers.
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "EOS|RequestJournal")
+    UEOSRequestJournal* RequestJournal;
+
+    /**
+     * @brief Retrieves the EOS Request Journal.
+     * 
+     * @return A pointer to the EOS Request Journal.
+     */
+    UFUNCTION(BlueprintCallable,Category = "EOS|RequestJournal|Query")
+    UEOSRequestJournal* GetRequestJournal();
   
   
     /**
@@ -70,6 +153,13 @@ public:
      */
     virtual void Init() override;
 
+    /**
+     * @brief Shuts down the EOS strategy core.
+     * 
+     * This function persists the state of the handlers that outlive the session, such as unflushed stats.
+     */
+    virtual void Shutdown() override;
+
     /**
      * @brief Checks if the EOS subsystem is initialized.
      * 
@@ -112,6 +202,90 @@ public:
      */
     IOnlineSessionPtr GetOnlineSession() const;
 
+    /**
+     * @brief Checks if the EOS friends interface is available.
+     * 
+     * @return true if the EOS friends interface is available, false otherwise.
+     */
+    bool HasOnlineFriends() const;
+
+    /**
+     * @brief Retrieves the EOS friends interface.
+     * 
+     * @return A pointer to the EOS friends interface.
+     */
+    IOnlineFriendsPtr GetOnlineFriends() const;
+
+    /**
+     * @brief Checks if the EOS presence interface is available.
+     * 
+     * @return true if the EOS presence interface is available, false otherwise.
+     */
+    bool HasOnlinePresence() const;
+
+    /**
+     * @brief Retrieves the EOS presence interface.
+     * 
+     * @return A pointer to the EOS presence interface.
+     */
+    IOnlinePresencePtr GetOnlinePresence() const;
+
+    /**
+     * @brief Checks if the EOS stats interface is available.
+     * 
+     * @return true if the EOS stats interface is available, false otherwise.
+     */
+    bool HasOnlineStats() const;
+
+    /**
+     * @brief Retrieves the EOS stats interface.
+     * 
+     * @return A pointer to the EOS stats interface.
+     */
+    IOnlineStatsPtr GetOnlineStats() const;
+
+    /**
+     * @brief Checks if the EOS leaderboards interface is available.
+     * 
+     * @return true if the EOS leaderboards interface is available, false otherwise.
+     */
+    bool HasOnlineLeaderboards() const;
+
+    /**
+     * @brief Retrieves the EOS leaderboards interface.
+     * 
+     * @return A pointer to the EOS leaderboards interface.
+     */
+    IOnlineLeaderboardsPtr GetOnlineLeaderboards() const;
+
+    /**
+     * @brief Checks if the EOS title file interface is available.
+     * 
+     * @return true if the EOS title file interface is available, false otherwise.
+     */
+    bool HasOnlineTitleFile() const;
+
+    /**
+     * @brief Retrieves the EOS title file interface.
+     * 
+     * @return A pointer to the EOS title file interface.
+     */
+    IOnlineTitleFilePtr GetOnlineTitleFile() const;
+
+    /**
+     * @brief Checks if the EOS user cloud interface is available.
+     * 
+     * @return true if the EOS user cloud interface is available, false otherwise.
+     */
+    bool HasOnlineUserCloud() const;
+
+    /**
+     * @brief Retrieves the EOS user cloud interface.
+     * 
+     * @return A pointer to the EOS user cloud interface.
+     */
+    IOnlineUserCloudPtr GetOnlineUserCloud() const;
+
 protected:
 
 private:
@@ -123,5 +297,23 @@ private:
 
     // Reference to the online session interface.
     IOnlineSessionPtr OnlineSession = nullptr;
+
+    // Reference to the online friends interface.
+    IOnlineFriendsPtr OnlineFriends = nullptr;
+
+    // Reference to the online presence interface.
+    IOnlinePresencePtr OnlinePresence = nullptr;
+
+    // Reference to the online stats interface.
+    IOnlineStatsPtr OnlineStats = nullptr;
+
+    // Reference to the online leaderboards interface.
+    IOnlineLeaderboardsPtr OnlineLeaderboards = nullptr;
+
+    // Reference to the online title file interface.
+    IOnlineTitleFilePtr OnlineTitleFile = nullptr;
+
+    // Reference to the online user cloud interface.
+    IOnlineUserCloudPtr OnlineUserCloud = nullptr;
     
 };